@@ -47,6 +47,7 @@
 #include "ags/engine/ac/screen.h"
 #include "ags/engine/ac/string.h"
 #include "ags/engine/ac/system.h"
+#include "ags/engine/ac/view_frame.h"
 #include "ags/engine/ac/walkable_area.h"
 #include "ags/engine/ac/walk_behind.h"
 #include "ags/engine/ac/dynobj/script_object.h"
@@ -845,6 +846,19 @@ void load_new_room(int newnum, CharacterInfo *forchar) {
 	if (_GP(game).color_depth > 1)
 		setpal();
 
+	// Queue the sprites of the room's characters and animated objects,
+	// so that they get decoded during the idle frame time instead of
+	// on their first appearance
+	_GP(spriteset).ClearPrefetch();
+	for (int cc = 0; cc < _GP(game).numcharacters; cc++) {
+		if (_GP(game).chars[cc].room == _G(displayed_room) && _GP(game).chars[cc].on)
+			prefetch_view(_GP(game).chars[cc].view);
+	}
+	for (size_t cc = 0; cc < _G(croom)->numobj; cc++) {
+		if (_G(objs)[cc].on && _G(objs)[cc].view != RoomObject::NoView)
+			prefetch_view(_G(objs)[cc].view);
+	}
+
 	_G(our_eip) = 220;
 	update_polled_stuff();
 	debug_script_log("Now in room %d", _G(displayed_room));
@@ -22,6 +22,7 @@
 #include "common/std/thread.h"
 #include "ags/engine/ac/timer.h"
 #include "ags/shared/core/platform.h"
+#include "ags/shared/ac/sprite_cache.h"
 #include "ags/engine/ac/sys_events.h"
 #include "ags/engine/platform/base/ags_platform_driver.h"
 #include "ags/ags.h"
@@ -80,8 +81,15 @@ void WaitForNextFrame() {
 	}
 
 	if (_G(next_frame_timestamp) > now) {
-		auto frame_time_remaining = _G(next_frame_timestamp) - now;
-		std::this_thread::sleep_for(frame_time_remaining);
+		// Spend a part of the idle time decoding the prefetched sprites;
+		// the budget is checked between sprites, so leave a safe margin
+		if (_GP(spriteset).HasPendingPrefetch())
+			_GP(spriteset).ProcessPrefetch((_G(next_frame_timestamp) - now) / 2);
+		const auto after = AGS_Clock::now();
+		if (_G(next_frame_timestamp) > after) {
+			auto frame_time_remaining = _G(next_frame_timestamp) - after;
+			std::this_thread::sleep_for(frame_time_remaining);
+		}
 	}
 
 	_G(last_tick_time) = _G(next_frame_timestamp);
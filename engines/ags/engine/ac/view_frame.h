@@ -51,6 +51,8 @@ int  ViewFrame_GetLoop(ScriptViewFrame *svf);
 int  ViewFrame_GetFrame(ScriptViewFrame *svf);
 
 void precache_view(int view);
+// queues all the view's sprites for the deferred loading, without locking them
+void prefetch_view(int view);
 // Handle the new animation frame (play linked sounds, etc);
  // sound_volume is an optional relative factor, -1 means not use
  void CheckViewFrame(int view, int loop, int frame, int sound_volume = -1);
@@ -55,6 +55,7 @@ ScummVMRendererGraphicsDriver::ScummVMRendererGraphicsDriver() {
 
 ScummVMRendererGraphicsDriver::~ScummVMRendererGraphicsDriver() {
 	delete _screen;
+	_lastFrame.free();
 	ScummVMRendererGraphicsDriver::UnInit();
 }
 
@@ -168,6 +169,8 @@ void ScummVMRendererGraphicsDriver::DestroyVirtualScreen() {
 	_origVirtualScreen.reset();
 	virtualScreen = nullptr;
 	_stageVirtualScreen = nullptr;
+	_lastFrame.free();
+	_fullPresent = true;
 }
 
 void ScummVMRendererGraphicsDriver::ReleaseDisplayMode() {
@@ -533,6 +536,60 @@ void ScummVMRendererGraphicsDriver::copySurface(const Graphics::Surface &src, bo
 		_screen->addDirtyRect(Common::Rect(x1, y1, x2 + 1, y2 + 1));
 }
 
+bool ScummVMRendererGraphicsDriver::updateDirtyRects(const Graphics::Surface &src, const Graphics::PixelFormat &screenFormat) {
+	_dirtyRects.clear();
+	if (_inScreenEffect) {
+		// The stored copy gets out of sync, resync on the first frame after the effect
+		_fullPresent = true;
+		return false;
+	}
+	if (_fullPresent || _lastFrame.w != src.w || _lastFrame.h != src.h ||
+			_lastFrame.format != src.format || _lastFrameScreenFormat != screenFormat) {
+		_lastFrame.free();
+		_lastFrame.copyFrom(src);
+		_lastFrameScreenFormat = screenFormat;
+		_fullPresent = false;
+		return false;
+	}
+
+	// Find the changed span of each row, and merge adjacent changed rows into
+	// bands; most AGS scenes are largely static, so this leaves few small rects
+	const int bpp = src.format.bytesPerPixel;
+	const int rowSize = src.w * bpp;
+	Common::Rect band;
+	bool inBand = false;
+	for (int y = 0; y < src.h; ++y) {
+		const byte *srcRow = (const byte *)src.getBasePtr(0, y);
+		byte *lastRow = (byte *)_lastFrame.getBasePtr(0, y);
+		if (memcmp(srcRow, lastRow, rowSize) == 0) {
+			if (inBand) {
+				_dirtyRects.push_back(band);
+				inBand = false;
+			}
+			continue;
+		}
+
+		int x1 = 0, x2 = src.w - 1;
+		while (memcmp(srcRow + x1 * bpp, lastRow + x1 * bpp, bpp) == 0)
+			++x1;
+		while (memcmp(srcRow + x2 * bpp, lastRow + x2 * bpp, bpp) == 0)
+			--x2;
+		memcpy(lastRow + x1 * bpp, srcRow + x1 * bpp, (x2 - x1 + 1) * bpp);
+
+		if (inBand) {
+			band.left = MIN<int16>(band.left, x1);
+			band.right = MAX<int16>(band.right, x2 + 1);
+			band.bottom = y + 1;
+		} else {
+			band = Common::Rect(x1, y, x2 + 1, y + 1);
+			inBand = true;
+		}
+	}
+	if (inBand)
+		_dirtyRects.push_back(band);
+	return true;
+}
+
 void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicFlip flip) {
 	Graphics::Surface *srcTransformed = nullptr;
 	if (xoff != 0 || yoff != 0 || flip != Shared::kFlip_None) {
@@ -586,6 +643,14 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 	if (renderMode != kRenderDirect && !_screen)
 		_screen = new Graphics::Screen();
 
+	// Only the changed regions are sent to the screen, unless the frame
+	// was transformed, in which case it is presented whole
+	bool hasDirtyRects = false;
+	if (srcTransformed || renderMode == kRenderToABGR || renderMode == kRenderToRGBA)
+		_fullPresent = true; // copySurface does its own comparison
+	else
+		hasDirtyRects = updateDirtyRects(src, screenFormat);
+
 	switch (renderMode) {
 	case kRenderToABGR:
 		// ARGB to ABGR
@@ -603,14 +668,25 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 		Graphics::Surface srcCopy = src;
 		srcCopy.format.aLoss = 8;
 
-		_screen->blitFrom(srcCopy);
+		if (hasDirtyRects) {
+			for (const auto &r : _dirtyRects)
+				_screen->blitFrom(srcCopy, r, Common::Point(r.left, r.top));
+		} else {
+			_screen->blitFrom(srcCopy);
+		}
 		break;
 	}
 
 	case kRenderDirect:
 		// Blit the virtual surface directly to the screen
-		g_system->copyRectToScreen(src.getPixels(), src.pitch,
-			0, 0, src.w, src.h);
+		if (hasDirtyRects) {
+			for (const auto &r : _dirtyRects)
+				g_system->copyRectToScreen(src.getBasePtr(r.left, r.top), src.pitch,
+					r.left, r.top, r.width(), r.height());
+		} else {
+			g_system->copyRectToScreen(src.getPixels(), src.pitch,
+				0, 0, src.w, src.h);
+		}
 		g_system->updateScreen();
 		if (srcTransformed) {
 			srcTransformed->free();
@@ -714,6 +790,7 @@ void ScummVMRendererGraphicsDriver::highcolor_fade_in(Bitmap *vs, void(*draw_cal
 
 	Bitmap *bmp_buff = new Bitmap(bmp_orig->GetWidth(), bmp_orig->GetHeight(), col_depth);
 	SetMemoryBackBuffer(bmp_buff);
+	_inScreenEffect = true;
 	for (int a = 0; a < 256; a += speed) {
 		bmp_buff->Fill(clearColor);
 		set_trans_blender(0, 0, 0, a);
@@ -730,6 +807,7 @@ void ScummVMRendererGraphicsDriver::highcolor_fade_in(Bitmap *vs, void(*draw_cal
 
 		WaitForNextFrame();
 	}
+	_inScreenEffect = false;
 	delete bmp_buff;
 
 	SetMemoryBackBuffer(vs);
@@ -748,6 +826,7 @@ void ScummVMRendererGraphicsDriver::highcolor_fade_out(Bitmap *vs, void(*draw_ca
 
 	Bitmap *bmp_buff = new Bitmap(bmp_orig->GetWidth(), bmp_orig->GetHeight(), col_depth);
 	SetMemoryBackBuffer(bmp_buff);
+	_inScreenEffect = true;
 	for (int a = 255 - speed; a > 0; a -= speed) {
 		bmp_buff->Fill(clearColor);
 		set_trans_blender(0, 0, 0, a);
@@ -764,6 +843,7 @@ void ScummVMRendererGraphicsDriver::highcolor_fade_out(Bitmap *vs, void(*draw_ca
 
 		WaitForNextFrame();
 	}
+	_inScreenEffect = false;
 	delete bmp_buff;
 
 	SetMemoryBackBuffer(vs);
@@ -845,6 +925,7 @@ void ScummVMRendererGraphicsDriver::BoxOutEffect(bool blackingOut, int speed, in
 		Bitmap *bmp_orig = virtualScreen;
 		Bitmap *bmp_buff = new Bitmap(bmp_orig->GetWidth(), bmp_orig->GetHeight(), bmp_orig->GetColorDepth());
 		SetMemoryBackBuffer(bmp_buff);
+		_inScreenEffect = true;
 
 		while (boxwid < _srcRect.GetWidth()) {
 			boxwid += speed;
@@ -866,6 +947,7 @@ void ScummVMRendererGraphicsDriver::BoxOutEffect(bool blackingOut, int speed, in
 
 			_G(platform)->Delay(delay);
 		}
+		_inScreenEffect = false;
 		delete bmp_buff;
 		SetMemoryBackBuffer(bmp_orig);
 	} else {
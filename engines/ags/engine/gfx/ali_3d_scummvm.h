@@ -203,6 +203,9 @@ public:
 	void SetScreenFade(int red, int green, int blue) override;
 	void SetScreenTint(int red, int green, int blue) override;
 	void SetStageScreen(const Size &sz, int x = 0, int y = 0) override;
+	void InvalidatePresentedScreen() override {
+		_fullPresent = true;
+	}
 
 	void RenderToBackBuffer() override;
 	void Render() override;
@@ -274,6 +277,18 @@ private:
 	Bitmap *_stageVirtualScreen;
 	int _tint_red, _tint_green, _tint_blue;
 
+	// Copy of the last presented frame, used to find the changed regions
+	// of the next one, so that only these are sent to the backend
+	Graphics::Surface _lastFrame;
+	Graphics::PixelFormat _lastFrameScreenFormat;
+	// Regions of the current frame which differ from the last presented one
+	std::vector<Common::Rect> _dirtyRects;
+	// Tells that the next frame has to be presented whole
+	bool _fullPresent = true;
+	// Tells that a full screen effect (e.g. fade) is in progress:
+	// every frame changes entirely, so skip the comparison
+	bool _inScreenEffect = false;
+
 	// Sprite batches (parent scene nodes)
 	ALSpriteBatches _spriteBatches;
 	// List of sprites to render
@@ -296,6 +311,9 @@ private:
 	void __fade_out_range(int speed, int from, int to, int targetColourRed, int targetColourGreen, int targetColourBlue);
 	// Copy raw screen bitmap pixels to the screen
 	void copySurface(const Graphics::Surface &src, bool mode);
+	// Compares the frame with the last presented one, fills _dirtyRects with the changed
+	// regions and syncs the stored copy; returns false if the whole frame must be presented
+	bool updateDirtyRects(const Graphics::Surface &src, const Graphics::PixelFormat &screenFormat);
 	// Render bitmap on screen
 	void Present(int xoff = 0, int yoff = 0, Shared::GraphicFlip flip = Shared::kFlip_None);
 };
@@ -179,6 +179,9 @@ public:
 	virtual void SetStageScreen(const Size &sz, int x = 0, int y = 0) = 0;
 	// Clears all sprite batches, resets batch counter
 	virtual void ClearDrawLists() = 0;
+	// Tells that the system screen was drawn to outside of the driver,
+	// so the next frame must be presented whole
+	virtual void InvalidatePresentedScreen() = 0;
 	virtual void RenderToBackBuffer() = 0;
 	virtual void Render() = 0;
 	// Renders with additional final offset and flip
@@ -82,8 +82,9 @@ static bool play_video(Video::VideoDecoder *decoder, const char *name, int flags
 
 	update_polled_stuff();
 
+	bool skipped = false;
 	decoder->start();
-	while (!SHOULD_QUIT && !decoder->endOfVideo()) {
+	while (!SHOULD_QUIT && !decoder->endOfVideo() && !skipped) {
 		if (decoder->needsUpdate()) {
 			// Get the next video frame and draw onto the screen
 			const Graphics::Surface *frame = decoder->decodeNextFrame();
@@ -131,12 +132,18 @@ static bool play_video(Video::VideoDecoder *decoder, const char *name, int flags
 				}
 			}
 			if (do_break)
-				return true; // skip on key press
-			if (run_service_mb_controls(mbut, mwheelz) && mbut >= kMouseNone && skip == VideoSkipKeyOrMouse)
-				return true; // skip on mouse click
+				skipped = true; // skip on key press
+			else if (run_service_mb_controls(mbut, mwheelz) && mbut >= kMouseNone && skip == VideoSkipKeyOrMouse)
+				skipped = true; // skip on mouse click
 		}
 	}
 
+	// The video was drawn directly to the system screen, behind the
+	// graphics driver's back
+	_G(gfxDriver)->InvalidatePresentedScreen();
+	if (skipped)
+		return true;
+
 	// Clear the screen after playback
 	if (_G(gfxDriver)->UsesMemoryBackBuffer())
 		_G(gfxDriver)->GetMemoryBackBuffer()->Clear();
@@ -101,6 +101,7 @@ void SpriteCache::Reset() {
 	}
 	_spriteData.clear();
 	_mru.clear();
+	_prefetch.clear();
 	_cacheSize = 0;
 	_lockedSize = 0;
 }
@@ -211,9 +212,15 @@ Bitmap *SpriteCache::operator [] (sprkey_t index) {
 		return _spriteData[index].Image;
 
 	if (_spriteData[index].Image) {
+		_stats.Hits++;
+		if (_spriteData[index].Flags & SPRCACHEFLAG_PREFETCHED) {
+			_stats.PrefetchHits++;
+			_spriteData[index].Flags &= ~SPRCACHEFLAG_PREFETCHED;
+		}
 		// Move to the beginning of the MRU list
 		_mru.splice(_mru.begin(), _mru, _spriteData[index].MruIt);
 	} else {
+		_stats.Misses++;
 		// Sprite exists in file but is not in mem, load it
 		LoadSprite(index);
 		_spriteData[index].MruIt = _mru.insert(_mru.begin(), index);
@@ -259,6 +266,8 @@ void SpriteCache::DisposeOldest() {
 		_cacheSize -= _spriteData[sprnum].Size;
 		delete _spriteData[*it].Image;
 		_spriteData[sprnum].Image = nullptr;
+		_spriteData[sprnum].Flags &= ~SPRCACHEFLAG_PREFETCHED;
+		_stats.Evictions++;
 		SprCacheLog("DisposeOldest: disposed %d, size now %d KB", sprnum, _cacheSize / 1024);
 	}
 	// Remove from the mru list
@@ -304,9 +313,56 @@ void SpriteCache::Precache(sprkey_t index) {
 	_maxCacheSize += sprSize;
 	_lockedSize += sprSize;
 	_spriteData[index].Flags |= SPRCACHEFLAG_LOCKED;
+	_spriteData[index].Flags &= ~SPRCACHEFLAG_PREFETCHED;
 	SprCacheLog("Precached %d", index);
 }
 
+void SpriteCache::Prefetch(sprkey_t index) {
+	if (index < 0 || (size_t)index >= _spriteData.size())
+		return;
+	if (!_spriteData[index].IsAssetSprite() || _spriteData[index].Image)
+		return; // not a resource sprite, or already in memory
+	_prefetch.push(index);
+}
+
+size_t SpriteCache::ProcessPrefetch(uint32_t time_budget_ms) {
+	const uint32 start = g_system->getMillis();
+	while (!_prefetch.empty()) {
+		const sprkey_t index = _prefetch.pop();
+		// The slot could have been changed or loaded since it was queued
+		if ((size_t)index >= _spriteData.size())
+			continue;
+		SpriteData &spr = _spriteData[index];
+		if (!spr.IsAssetSprite() || spr.Image || (spr.Flags & SPRCACHEFLAG_REMAPPED) != 0)
+			continue;
+		// Prefetch must never push out sprites which are already in use;
+		// estimate the size using the max possible color depth
+		const size_t est_size = _sprInfos[index].Width * _sprInfos[index].Height * 4;
+		if (_cacheSize + est_size > _maxCacheSize) {
+			SprCacheLog("Prefetch: cache is full, dropping %d requests", _prefetch.size() + 1);
+			_prefetch.clear();
+			break;
+		}
+		LoadSprite(index);
+		if (spr.Image) {
+			spr.MruIt = _mru.insert(_mru.begin(), index);
+			spr.Flags |= SPRCACHEFLAG_PREFETCHED;
+			_stats.Prefetched++;
+		}
+		if (g_system->getMillis() - start >= time_budget_ms)
+			break;
+	}
+	return (size_t)_prefetch.size();
+}
+
+bool SpriteCache::HasPendingPrefetch() const {
+	return !_prefetch.empty();
+}
+
+void SpriteCache::ClearPrefetch() {
+	_prefetch.clear();
+}
+
 sprkey_t SpriteCache::GetDataIndex(sprkey_t index) {
 	return (_spriteData[index].Flags & SPRCACHEFLAG_REMAPPED) == 0 ? index : 0;
 }
@@ -331,6 +387,7 @@ size_t SpriteCache::LoadSprite(sprkey_t index) {
 	_sprInfos[index].Width = image->GetWidth();
 	_sprInfos[index].Height = image->GetHeight();
 	_spriteData[index].Image = image;
+	_spriteData[index].Flags &= ~SPRCACHEFLAG_PREFETCHED;
 
 	// Stop it adding the sprite to the used list just because it's loaded
 	// TODO: this messy hack is required, because initialize_sprite calls operator[]
@@ -392,6 +449,7 @@ HError SpriteCache::InitFile(const String &filename, const String &sprindex_file
 	_sprInfos.resize(newsize);
 	_spriteData.resize(newsize);
 	_mru.clear();
+	_prefetch.clear();
 	for (size_t i = 0; i < metrics.size(); ++i) {
 		if (!metrics[i].IsNull()) {
 			// Existing sprite
@@ -44,6 +44,7 @@
 #include "common/std/memory.h"
 #include "common/std/vector.h"
 #include "common/std/list.h"
+#include "common/std/queue.h"
 #include "ags/shared/ac/sprite_file.h"
 #include "ags/shared/core/platform.h"
 #include "ags/shared/util/error.h"
@@ -70,6 +71,8 @@ struct SpriteInfo;
 #define SPRCACHEFLAG_REMAPPED       0x02
 // Locked sprites are ones that should not be freed when out of cache space.
 #define SPRCACHEFLAG_LOCKED         0x04
+// Tells that the sprite was loaded by prefetch and was not requested yet.
+#define SPRCACHEFLAG_PREFETCHED     0x08
 
 // Max size of the sprite cache, in bytes
 #if AGS_PLATFORM_OS_ANDROID || AGS_PLATFORM_OS_IOS
@@ -124,6 +127,16 @@ public:
 	size_t      GetSpriteSlotCount() const;
 	// Loads sprite and and locks in memory (so it cannot get removed implicitly)
 	void        Precache(sprkey_t index);
+	// Queues sprite for the deferred loading; the sprite is put into the
+	// regular MRU cache when the queue is processed, and is not locked
+	void        Prefetch(sprkey_t index);
+	// Loads queued sprites until the queue is empty or the time budget
+	// (in milliseconds) runs out; returns number of sprites still queued
+	size_t      ProcessPrefetch(uint32_t time_budget_ms);
+	// Tells if there are sprites waiting in the prefetch queue
+	bool        HasPendingPrefetch() const;
+	// Drops all the pending prefetch requests
+	void        ClearPrefetch();
 	// Remap the given index to the sprite 0
 	void        RemapSpriteToSprite0(sprkey_t index);
 	// Unregisters sprite from the bank and optionally deletes bitmap
@@ -147,6 +160,22 @@ public:
 	// Loads (if it's not in cache yet) and returns bitmap by the sprite index
 	Shared::Bitmap *operator[](sprkey_t index);
 
+	// Cache usage counters, for the diagnostics
+	struct Stats {
+		uint32_t Hits = 0;       // sprite requested and found in memory
+		uint32_t Misses = 0;     // sprite requested and had to be loaded
+		uint32_t Evictions = 0;  // sprites disposed to free cache space
+		uint32_t Prefetched = 0; // sprites loaded from the prefetch queue
+		uint32_t PrefetchHits = 0; // prefetched sprites requested before eviction
+	};
+
+	inline const Stats &GetStats() const {
+		return _stats;
+	}
+	inline void ResetStats() {
+		_stats = Stats();
+	}
+
 private:
 	// Load sprite from game resource
 	size_t      LoadSprite(sprkey_t index);
@@ -193,6 +222,10 @@ private:
 	// When clearing up space for new sprites, cache first deletes the sprites
 	// that were last time used long ago.
 	std::list<sprkey_t> _mru;
+	// Sprites requested for the deferred loading, in the order of request
+	std::queue<sprkey_t> _prefetch;
+
+	Stats _stats;
 
 	// Initialize the empty sprite slot
 	void        InitNullSpriteParams(sprkey_t index);
@@ -485,6 +485,289 @@ void inkDrawPixel(int x, int y, int src, void *data) {
 	}
 }
 
+// Specialized row kernels for DirectorPlotData::inkBlitSurface().
+//
+// When a bitmap is composited without a shape, blend factor or text
+// preprocessing, the result of every pixel only depends on the ink, the
+// pixel format and a few colours which are constant for the whole blit.
+// In that case we pick the kernel once and run it over each row, instead of
+// calling inkDrawPixel() through a function pointer for every pixel.
+// The loops for the bitwise inks are kept trivial, so that the compiler can
+// vectorize them.
+
+typedef void (*InkRowPtr)(DirectorPlotData *p, void *dst, const void *src, const byte *msk, int width);
+
+template <typename T>
+struct InkColors;
+
+template <>
+struct InkColors<byte> {
+	const byte *palette;
+	Graphics::MacWindowManager *wm;
+
+	InkColors(DirectorPlotData *p) : palette(p->d->_wm->getPalette()), wm(p->d->_wm) {}
+
+	inline void decompose(uint32 color, byte &r, byte &g, byte &b) const {
+		r = palette[3 * (byte)color + 0];
+		g = palette[3 * (byte)color + 1];
+		b = palette[3 * (byte)color + 2];
+	}
+	inline uint32 compose(byte r, byte g, byte b) const {
+		return wm->findBestColor(r, g, b);
+	}
+};
+
+template <>
+struct InkColors<uint32> {
+	Graphics::PixelFormat format;
+
+	InkColors(DirectorPlotData *p) : format(p->d->_wm->_pixelformat) {}
+
+	inline void decompose(uint32 color, byte &r, byte &g, byte &b) const {
+		format.colorToRGB(color, r, g, b);
+	}
+	inline uint32 compose(byte r, byte g, byte b) const {
+		return format.RGBToColor(r, g, b);
+	}
+};
+
+template <typename T>
+struct InkOpCopy {
+	InkOpCopy(DirectorPlotData *) {}
+	inline T operator()(T src, T) const { return src; }
+};
+
+template <typename T>
+struct InkOpTransparent {
+	InkOpTransparent(DirectorPlotData *) {}
+	inline T operator()(T src, T dst) const { return dst | src; }
+};
+
+template <typename T>
+struct InkOpNotTrans {
+	InkOpNotTrans(DirectorPlotData *) {}
+	inline T operator()(T src, T dst) const { return dst | ~src; }
+};
+
+template <typename T>
+struct InkOpReverse {
+	InkOpReverse(DirectorPlotData *) {}
+	inline T operator()(T src, T dst) const { return dst ^ src; }
+};
+
+template <typename T>
+struct InkOpNotReverse {
+	InkOpNotReverse(DirectorPlotData *) {}
+	inline T operator()(T src, T dst) const { return dst ^ ~src; }
+};
+
+template <typename T>
+struct InkOpGhost {
+	InkOpGhost(DirectorPlotData *) {}
+	inline T operator()(T src, T dst) const { return dst & ~src; }
+};
+
+template <typename T>
+struct InkOpNotGhost {
+	InkOpNotGhost(DirectorPlotData *) {}
+	inline T operator()(T src, T dst) const { return dst & src; }
+};
+
+template <typename T>
+struct InkOpBackgndTrans {
+	T key;
+	InkOpBackgndTrans(DirectorPlotData *p) : key(p->backColor) {}
+	inline T operator()(T src, T dst) const { return src == key ? dst : src; }
+};
+
+// Replaces pixels of one colour with another, keeps the rest of the destination;
+// this is how the colourized and one-bit variants of the inks behave
+template <typename T>
+struct InkOpKeyFill {
+	T key, color;
+	InkOpKeyFill(T k, T c) : key(k), color(c) {}
+	inline T operator()(T src, T dst) const { return src == key ? color : dst; }
+};
+
+// Colourized Copy and NotCopy for the 8-bit mode
+template <typename T, bool Inverse>
+struct InkOpApplyColorIndexed {
+	T fore, back;
+	InkOpApplyColorIndexed(DirectorPlotData *p) : fore(Inverse ? p->backColor : p->foreColor), back(Inverse ? p->foreColor : p->backColor) {}
+	inline T operator()(T src, T dst) const {
+		return src == 0xff ? fore : (src == 0x00 ? back : (Inverse ? src : dst));
+	}
+};
+
+// Colourized Copy and NotCopy for the true colour mode
+template <typename T, bool Inverse>
+struct InkOpApplyColorRGB {
+	InkColors<T> colors;
+	byte rFor, gFor, bFor;
+	byte rBak, gBak, bBak;
+
+	InkOpApplyColorRGB(DirectorPlotData *p) : colors(p) {
+		colors.decompose(p->foreColor, rFor, gFor, bFor);
+		colors.decompose(p->backColor, rBak, gBak, bBak);
+	}
+	inline T operator()(T src, T) const {
+		byte rSrc, gSrc, bSrc;
+		colors.decompose(src, rSrc, gSrc, bSrc);
+		if (Inverse)
+			return colors.compose((~rSrc | rFor) & (rSrc | rBak), (~gSrc | gFor) & (gSrc | gBak), (~bSrc | bFor) & (bSrc | bBak));
+		return colors.compose((rSrc | rFor) & (~rSrc | rBak), (gSrc | gFor) & (~gSrc | gBak), (bSrc | bFor) & (~bSrc | bBak));
+	}
+};
+
+template <typename T>
+struct InkOpNotCopy {
+	InkColors<T> colors;
+	InkOpNotCopy(DirectorPlotData *p) : colors(p) {}
+	inline T operator()(T src, T) const {
+		byte rSrc, gSrc, bSrc;
+		colors.decompose(src, rSrc, gSrc, bSrc);
+		return colors.compose(~rSrc, ~gSrc, ~bSrc);
+	}
+};
+
+// Arithmetic inks, based on real color values
+template <typename T, InkType Ink>
+struct InkOpArithmetic {
+	InkColors<T> colors;
+	InkOpArithmetic(DirectorPlotData *p) : colors(p) {}
+	inline T operator()(T src, T dst) const {
+		byte rSrc, gSrc, bSrc;
+		byte rDst, gDst, bDst;
+		colors.decompose(src, rSrc, gSrc, bSrc);
+		colors.decompose(dst, rDst, gDst, bDst);
+
+		switch (Ink) {
+		case kInkTypeAddPin:
+			return colors.compose(rDst + MIN(0xff - rDst, (int)rSrc), gDst + MIN(0xff - gDst, (int)gSrc), bDst + MIN(0xff - bDst, (int)bSrc));
+		case kInkTypeAdd:
+			return colors.compose(rDst + rSrc, gDst + gSrc, bDst + bSrc);
+		case kInkTypeSubPin:
+			return colors.compose(MAX(rDst - rSrc, 1) - 1, MAX(gDst - gSrc, 1) - 1, MAX(bDst - bSrc, 1) - 1);
+		case kInkTypeLight:
+			return colors.compose(MAX(rSrc, rDst), MAX(gSrc, gDst), MAX(bSrc, bDst));
+		case kInkTypeSub:
+			return colors.compose(rDst - rSrc, gDst - gSrc, bDst - bSrc);
+		case kInkTypeDark:
+			return colors.compose(MIN(rSrc, rDst), MIN(gSrc, gDst), MIN(bSrc, bDst));
+		default:
+			return dst;
+		}
+	}
+};
+
+template <typename T, typename Op>
+static void inkBlitRow(const Op &op, T *dst, const T *src, const byte *msk, int width) {
+	if (msk) {
+		for (int j = 0; j < width; j++) {
+			if (msk[j])
+				dst[j] = op(src[j], dst[j]);
+		}
+	} else {
+		for (int j = 0; j < width; j++)
+			dst[j] = op(src[j], dst[j]);
+	}
+}
+
+template <typename T, typename Op>
+static void inkBlitRowKernel(DirectorPlotData *p, void *dst, const void *src, const byte *msk, int width) {
+	inkBlitRow<T>(Op(p), (T *)dst, (const T *)src, msk, width);
+}
+
+template <typename T>
+static void inkBlitRowKeyFill(DirectorPlotData *p, void *dst, const void *src, const byte *msk, int width) {
+	T key = 0, color = 0;
+	switch (p->ink) {
+	case kInkTypeBackgndTrans:
+	case kInkTypeTransparent:
+		key = p->colorBlack;
+		color = p->foreColor;
+		break;
+	case kInkTypeNotTrans:
+		key = p->colorWhite;
+		color = p->foreColor;
+		break;
+	case kInkTypeGhost:
+		key = p->colorBlack;
+		color = p->backColor;
+		break;
+	case kInkTypeNotGhost:
+		key = p->colorWhite;
+		color = p->backColor;
+		break;
+	default:
+		break;
+	}
+	inkBlitRow<T>(InkOpKeyFill<T>(key, color), (T *)dst, (const T *)src, msk, width);
+}
+
+template <typename T>
+static InkRowPtr getInkRowKernel(DirectorPlotData *p) {
+	// These are handled only by the generic per-pixel path
+	if (p->ms || p->alpha || p->sprite == kTextSprite)
+		return nullptr;
+
+	switch (p->ink) {
+	case kInkTypeMatte:
+	case kInkTypeMask:
+	case kInkTypeBlend:
+	case kInkTypeCopy:
+		if (!p->applyColor)
+			return &inkBlitRowKernel<T, InkOpCopy<T> >;
+		if (sizeof(T) == 1)
+			return &inkBlitRowKernel<T, InkOpApplyColorIndexed<T, false> >;
+		return &inkBlitRowKernel<T, InkOpApplyColorRGB<T, false> >;
+	case kInkTypeNotCopy:
+		if (!p->applyColor)
+			return &inkBlitRowKernel<T, InkOpNotCopy<T> >;
+		if (sizeof(T) == 1)
+			return &inkBlitRowKernel<T, InkOpApplyColorIndexed<T, true> >;
+		return &inkBlitRowKernel<T, InkOpApplyColorRGB<T, true> >;
+	case kInkTypeBackgndTrans:
+		if (p->oneBitImage)
+			return &inkBlitRowKeyFill<T>;
+		return &inkBlitRowKernel<T, InkOpBackgndTrans<T> >;
+	case kInkTypeTransparent:
+		if (p->oneBitImage || p->applyColor)
+			return &inkBlitRowKeyFill<T>;
+		return &inkBlitRowKernel<T, InkOpTransparent<T> >;
+	case kInkTypeNotTrans:
+		if (p->oneBitImage || p->applyColor)
+			return &inkBlitRowKeyFill<T>;
+		return &inkBlitRowKernel<T, InkOpNotTrans<T> >;
+	case kInkTypeReverse:
+		return &inkBlitRowKernel<T, InkOpReverse<T> >;
+	case kInkTypeNotReverse:
+		return &inkBlitRowKernel<T, InkOpNotReverse<T> >;
+	case kInkTypeGhost:
+		if (p->oneBitImage || p->applyColor)
+			return &inkBlitRowKeyFill<T>;
+		return &inkBlitRowKernel<T, InkOpGhost<T> >;
+	case kInkTypeNotGhost:
+		if (p->oneBitImage || p->applyColor)
+			return &inkBlitRowKeyFill<T>;
+		return &inkBlitRowKernel<T, InkOpNotGhost<T> >;
+	case kInkTypeAddPin:
+		return &inkBlitRowKernel<T, InkOpArithmetic<T, kInkTypeAddPin> >;
+	case kInkTypeAdd:
+		return &inkBlitRowKernel<T, InkOpArithmetic<T, kInkTypeAdd> >;
+	case kInkTypeSubPin:
+		return &inkBlitRowKernel<T, InkOpArithmetic<T, kInkTypeSubPin> >;
+	case kInkTypeLight:
+		return &inkBlitRowKernel<T, InkOpArithmetic<T, kInkTypeLight> >;
+	case kInkTypeSub:
+		return &inkBlitRowKernel<T, InkOpArithmetic<T, kInkTypeSub> >;
+	case kInkTypeDark:
+		return &inkBlitRowKernel<T, InkOpArithmetic<T, kInkTypeDark> >;
+	default:
+		return nullptr;
+	}
+}
+
 Graphics::MacDrawPixPtr DirectorEngine::getInkDrawPixel() {
 	if (_pixelformat.bytesPerPixel == 1)
 		return &inkDrawPixel<byte>;
@@ -710,11 +993,22 @@ void DirectorPlotData::inkBlitSurface(Common::Rect &srcRect, const Graphics::Sur
 	// format as the window manager. Most of the time this is
 	// the job of BitmapCastMember::createWidget.
 
+	const int bpp = d->_wm->_pixelformat.bytesPerPixel;
+	InkRowPtr inkRow = (bpp == 1) ? getInkRowKernel<byte>(this) : getInkRowKernel<uint32>(this);
+
 	srcPoint.y = abs(srcRect.top - destRect.top);
 	for (int i = 0; i < destRect.height(); i++, srcPoint.y++) {
 		srcPoint.x = abs(srcRect.left - destRect.left);
 		const byte *msk = mask ? (const byte *)mask->getBasePtr(srcPoint.x, srcPoint.y) : nullptr;
 
+		// Rows which are entirely inside the source go through the specialized kernel
+		if (inkRow && srcPoint.y >= srfClip.top && srcPoint.y < srfClip.bottom &&
+				srcPoint.x >= srfClip.left && srcPoint.x + destRect.width() <= srfClip.right) {
+			inkRow(this, dst->getBasePtr(destRect.left, destRect.top + i),
+				srf->getBasePtr(srcPoint.x, srcPoint.y), msk, destRect.width());
+			continue;
+		}
+
 		for (int j = 0; j < destRect.width(); j++, srcPoint.x++) {
 			if (!srfClip.contains(srcPoint)) {
 				failedBoundsCheck = true;
@@ -722,7 +1016,7 @@ void DirectorPlotData::inkBlitSurface(Common::Rect &srcRect, const Graphics::Sur
 			}
 
 			if (!mask || (msk && (*msk++))) {
-				if (d->_wm->_pixelformat.bytesPerPixel == 1) {
+				if (bpp == 1) {
 					(d->getInkDrawPixel())(destRect.left + j, destRect.top + i,
 										preprocessColor(*((byte *)srf->getBasePtr(srcPoint.x, srcPoint.y))), this);
 				} else {
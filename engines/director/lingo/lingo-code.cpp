@@ -184,7 +184,7 @@ void Lingo::cleanupFuncs() {
 		delete it._value;
 }
 
-void Lingo::push(Datum d) {
+void Lingo::push(const Datum &d) {
 	_stack.push_back(d);
 }
 
@@ -1617,36 +1617,39 @@ void LC::call(const Common::String &name, int nargs, bool allowRetVal) {
 	// Handler
 	funcSym = g_lingo->getHandler(name);
 
-	if (g_lingo->_builtinListHandlers.contains(name) && nargs >= 1) {
-		// Lingo builtin functions in the "List" category have very strange override mechanics.
-		// If the first argument is an ARRAY or PARRAY, it will use the builtin.
-		// Otherwise, it will fall back to whatever handler is defined globally.
-		Datum firstArg = g_lingo->peek(nargs - 1);
-		if (firstArg.type == ARRAY || firstArg.type == PARRAY ||
-				firstArg.type == POINT || firstArg.type == RECT) {
-			funcSym = g_lingo->_builtinListHandlers[name];
+	// Each of the builtin tables is looked up once; the name hashing
+	// is a noticeable part of the call overhead
+	if (nargs >= 1) {
+		SymbolHash::const_iterator listHandler = g_lingo->_builtinListHandlers.find(name);
+		if (listHandler != g_lingo->_builtinListHandlers.end()) {
+			// Lingo builtin functions in the "List" category have very strange override mechanics.
+			// If the first argument is an ARRAY or PARRAY, it will use the builtin.
+			// Otherwise, it will fall back to whatever handler is defined globally.
+			const Datum &firstArg = g_lingo->_stack[g_lingo->_stack.size() - nargs];
+			if (firstArg.type == ARRAY || firstArg.type == PARRAY ||
+					firstArg.type == POINT || firstArg.type == RECT) {
+				funcSym = listHandler->_value;
+			}
 		}
 	}
 
 	if (funcSym.type == VOIDSYM) { // The built-ins could be overridden
 		// Builtin
-		if (allowRetVal) {
-			if (g_lingo->_builtinFuncs.contains(name)) {
-				funcSym = g_lingo->_builtinFuncs[name];
-			}
-		} else {
-			if (g_lingo->_builtinCmds.contains(name)) {
-				funcSym = g_lingo->_builtinCmds[name];
-			}
-		}
+		const SymbolHash &builtins = allowRetVal ? g_lingo->_builtinFuncs : g_lingo->_builtinCmds;
+		SymbolHash::const_iterator builtin = builtins.find(name);
+		if (builtin != builtins.end())
+			funcSym = builtin->_value;
 	}
 
 	// use lingo-the as fallback. we can only use functions as fallback, not properties
-	if (funcSym.type == VOIDSYM && g_lingo->_theEntities.contains(name) && g_lingo->_theEntities[name]->isFunction) {
-		Datum id;
-		Datum res = g_lingo->getTheEntity(g_lingo->_theEntities[name]->entity, id, kTheNOField);
-		g_lingo->push(res);
-		return;
+	if (funcSym.type == VOIDSYM) {
+		TheEntityHash::const_iterator theEntity = g_lingo->_theEntities.find(name);
+		if (theEntity != g_lingo->_theEntities.end() && theEntity->_value->isFunction) {
+			Datum id;
+			Datum res = g_lingo->getTheEntity(theEntity->_value->entity, id, kTheNOField);
+			g_lingo->push(res);
+			return;
+		}
 	}
 
 	call(funcSym, nargs, allowRetVal);
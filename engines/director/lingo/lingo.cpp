@@ -864,44 +864,56 @@ int Lingo::getAlignedType(const Datum &d1, const Datum &d2, bool equality) {
 Datum::Datum() {
 	u.s = nullptr;
 	type = VOID;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
 Datum::Datum(const Datum &d) {
 	type = d.type;
 	u = d.u;
-	refCount = d.refCount;
-	*refCount += 1;
+	refCount = d.shareRefCount();
 	ignoreGlobal = false;
 }
 
 Datum& Datum::operator=(const Datum &d) {
-	if (this != &d && refCount != d.refCount) {
+	if (this != &d && (refCount != d.refCount || !refCount)) {
+		// d may be owned by our own data, so take it before releasing that
+		int *newRefCount = d.shareRefCount();
+		DatumType newType = d.type;
+		auto newU = d.u;
 		reset();
-		type = d.type;
-		u = d.u;
-		refCount = d.refCount;
-		*refCount += 1;
+		type = newType;
+		u = newU;
+		refCount = newRefCount;
 	}
 	ignoreGlobal = false;
 	return *this;
 }
 
+int *Datum::shareRefCount() const {
+	if (!refCount) {
+		// Scalars are copied by value
+		if (isScalar())
+			return nullptr;
+		// Data of the sole owner gets shared for the first time
+		refCount = new int;
+		*refCount = 1;
+	}
+	*refCount += 1;
+	return refCount;
+}
+
 Datum::Datum(int val) {
 	u.i = val;
 	type = INT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
 Datum::Datum(double val) {
 	u.f = val;
 	type = FLOAT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
@@ -921,8 +933,7 @@ Datum::Datum(AbstractObject *val) {
 		*refCount += 1;
 	} else {
 		type = VOID;
-		refCount = new int;
-		*refCount = 1;
+		refCount = nullptr;
 	}
 	ignoreGlobal = false;
 }
@@ -958,8 +969,17 @@ Datum::Datum(const Common::Rect &rect) {
 }
 
 void Datum::reset() {
-	if (!refCount)
+	if (!refCount) {
+		// Either a scalar, or a sole owner of data assigned after
+		// construction (e.g. a VOID Datum turned into a STRING).
+		// Objects always bring their own counter, so these are not expected here.
+		if (!isScalar() && type != OBJECT) {
+			freeData();
+			type = VOID;
+			u.s = nullptr;
+		}
 		return;
+	}
 
 	*refCount -= 1;
 	// Coverity thinks that we always free memory, as it assumes
@@ -967,63 +987,67 @@ void Datum::reset() {
 	// Thus, DO NOT COMPILE, trick it and shut tons of false positives
 #ifndef __COVERITY__
 	if (*refCount <= 0) {
-		switch (type) {
-		case VOID:
-		case INT:
-		case FLOAT:
-		case ARGC:
-		case ARGCNORET:
-			break;
-		case VARREF:
-		case GLOBALREF:
-		case LOCALREF:
-		case PROPREF:
-		case STRING:
-		case SYMBOL:
-			delete u.s;
-			break;
-		case ARRAY:
-		case POINT:
-		case RECT:
-			delete u.farr;
-			break;
-		case PARRAY:
-			delete u.parr;
-			break;
-		case OBJECT:
-			if (u.obj->getObjType() == kWindowObj) {
-				// Window has an override for decRefCount, use it directly
-				*refCount += 1;
-				static_cast<Window *>(u.obj)->decRefCount();
-			} else {
-				// *refCount is copied between the Datum and the Object,
-				// so should be safe to delete the Object
-				delete u.obj;
-			}
-			break;
-		case CHUNKREF:
-			delete u.cref;
-			break;
-		case CASTREF:
-		case FIELDREF:
-			delete u.cast;
-			break;
-		case MENUREF:
-			delete u.menu;
-			break;
-		case PICTUREREF:
-			delete u.picture;
-			break;
-		default:
-			warning("Datum::reset(): Unprocessed REF type %d", type);
-			break;
-		}
+		freeData();
 		if (type != OBJECT) // object owns refCount
 			delete refCount;
 	}
 #endif
 }
 
+void Datum::freeData() {
+	switch (type) {
+	case VOID:
+	case INT:
+	case FLOAT:
+	case ARGC:
+	case ARGCNORET:
+		break;
+	case VARREF:
+	case GLOBALREF:
+	case LOCALREF:
+	case PROPREF:
+	case STRING:
+	case SYMBOL:
+		delete u.s;
+		break;
+	case ARRAY:
+	case POINT:
+	case RECT:
+		delete u.farr;
+		break;
+	case PARRAY:
+		delete u.parr;
+		break;
+	case OBJECT:
+		if (u.obj->getObjType() == kWindowObj) {
+			// Window has an override for decRefCount, use it directly
+			*refCount += 1;
+			static_cast<Window *>(u.obj)->decRefCount();
+		} else {
+			// *refCount is copied between the Datum and the Object,
+			// so should be safe to delete the Object
+			delete u.obj;
+		}
+		break;
+	case CHUNKREF:
+		delete u.cref;
+		break;
+	case CASTREF:
+	case FIELDREF:
+		delete u.cast;
+		break;
+	case MENUREF:
+		delete u.menu;
+		break;
+	case PICTUREREF:
+		delete u.picture;
+		break;
+	default:
+		warning("Datum::reset(): Unprocessed REF type %d", type);
+		break;
+	}
+}
+
 Datum Datum::eval() const {
 	if (isRef()) {
 		return g_lingo->varFetch(*this);
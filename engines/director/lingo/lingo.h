@@ -143,7 +143,11 @@ struct Datum {	/* interpreter stack type */
 		PictureReference *picture; /* PICTUREREF */
 	} u;
 
-	int *refCount;
+	// Shared reference counter for the heap data in u. Scalar values are
+	// not refcounted, and their counter is not allocated. nullptr also means
+	// that this Datum is the only owner of its data; the counter gets
+	// allocated when such data is shared with the first copy.
+	mutable int *refCount;
 
 	bool ignoreGlobal; // True if this Datum should be ignored by showGlobals and clearGlobals
 
@@ -163,6 +167,8 @@ struct Datum {	/* interpreter stack type */
 		reset();
 	}
 
+	bool isScalar() const { return type == VOID || type == INT || type == FLOAT || type == ARGC || type == ARGCNORET; }
+
 	Datum eval() const;
 	double asFloat() const;
 	int asInt() const;
@@ -186,6 +192,11 @@ struct Datum {	/* interpreter stack type */
 	bool operator<(Datum &d) const;
 	bool operator>=(Datum &d) const;
 	bool operator<=(Datum &d) const;
+
+private:
+	// Returns the counter to be stored in a new copy of this Datum
+	int *shareRefCount() const;
+	void freeData();
 };
 
 struct ChunkReference {
@@ -528,7 +539,7 @@ public:
 	Common::String _floatPrecisionFormat;
 
 public:
-	void push(Datum d);
+	void push(const Datum &d);
 	Datum pop();
 	Datum peek(uint offset);
 
@@ -1664,7 +1664,13 @@ void Score::loadFrames(Common::SeekableReadStreamEndian &stream, uint16 version)
 	// Calculate number of frames and their positions
 	// numOfFrames in the header is often incorrect
 	for (_numFrames = 1; loadFrame(_numFrames, false); _numFrames++) {
-		_scoreCache.push_back(new Frame(*_currentFrame));
+		Frame *frame = new Frame(*_currentFrame);
+		// Frame copy constructor skips some of the main channels, and the
+		// cached frames are also used to restore the keyframes
+		frame->_mainChannels = _currentFrame->_mainChannels;
+		_scoreCache.push_back(frame);
+		if (_numFrames % kScoreKeyframeInterval == 0)
+			addKeyframe();
 	}
 
 	debugC(1, kDebugLoading, "Score::loadFrames(): Calculated, total number of frames %d!", _numFrames);
@@ -1682,7 +1688,23 @@ bool Score::loadFrame(int frameNum, bool loadCast) {
 	int sourceFrame = _curFrameNumber;
 	int targetFrame = frameNum;
 
-	if (frameNum <= (int)_curFrameNumber) {
+	// Jump to the closest keyframe if we are going back, or jumping ahead
+	// past it. Stepping to the next frame keeps reading incrementally, as
+	// the current frame also holds the sprite state of the live channels.
+	const ScoreKeyframe *keyframe = findKeyframe(frameNum);
+	if (keyframe && (frameNum <= (int)_curFrameNumber ||
+			(keyframe->frameNum > _curFrameNumber && frameNum > (int)_curFrameNumber + 1))) {
+		debugC(7, kDebugLoading, "****** Restoring keyframe %d for frame %d", keyframe->frameNum, frameNum);
+		restoreKeyframe(*keyframe);
+		sourceFrame = keyframe->frameNum;
+
+		if (sourceFrame == targetFrame) {
+			_curFrameNumber = targetFrame;
+			if (loadCast)
+				setSpriteCasts();
+			return true;
+		}
+	} else if (frameNum <= (int)_curFrameNumber) {
 		debugC(7, kDebugLoading, "****** Resetting frame %d to start %" PRId64, sourceFrame, _framesStream->pos());
 		// If we are going back, we need to rebuild frames from start
 		_currentFrame->reset();
@@ -1764,6 +1786,39 @@ bool Score::readOneFrame() {
 	return false; // Error in loading frame
 }
 
+void Score::addKeyframe() {
+	ScoreKeyframe keyframe;
+	keyframe.frameNum = _curFrameNumber;
+	keyframe.streamPos = _framesStream->pos();
+	_keyframes.push_back(keyframe);
+}
+
+const ScoreKeyframe *Score::findKeyframe(uint32 frameNum) const {
+	// Keyframes are evenly spaced, so the closest one preceding the frame
+	// can be found directly
+	uint32 index = frameNum / kScoreKeyframeInterval;
+	if (index == 0)
+		return nullptr;
+	index = MIN<uint32>(index, _keyframes.size());
+	if (index == 0)
+		return nullptr;
+	return &_keyframes[index - 1];
+}
+
+void Score::restoreKeyframe(const ScoreKeyframe &keyframe) {
+	const Frame *frame = _scoreCache[keyframe.frameNum - 1];
+
+	// Recreate the sprites the same way as when replaying from the start
+	_currentFrame->reset();
+	_currentFrame->_mainChannels = frame->_mainChannels;
+	for (uint i = 0; i < _currentFrame->_sprites.size() && i < frame->_sprites.size(); i++) {
+		*_currentFrame->_sprites[i] = *frame->_sprites[i];
+		_currentFrame->_sprites[i]->_frame = _currentFrame;
+	}
+
+	_framesStream->seek(keyframe.streamPos);
+}
+
 Frame *Score::getFrameData(int frameNum){
 	// This function is for previewing selected frame,
 	// It doesn't make any changes to current render state
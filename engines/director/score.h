@@ -60,6 +60,18 @@ struct Label {
 	Label(Common::String name1, uint16 number1, Common::String comment1) { name = name1; number = number1; comment = comment1;}
 };
 
+// Point in the frames stream from which the score can be read without
+// replaying all the frame deltas from the beginning. The score state at
+// that point is the frame's copy in _scoreCache.
+struct ScoreKeyframe {
+	uint32 frameNum;
+	uint streamPos; // position of the next frame delta in the frames stream
+};
+
+// Distance between the score keyframes; seeking to any frame applies
+// at most this many frame deltas on top of a keyframe
+const uint32 kScoreKeyframeInterval = 32;
+
 class Score {
 public:
 	Score(Movie *movie);
@@ -70,6 +82,9 @@ public:
 	void loadFrames(Common::SeekableReadStreamEndian &stream, uint16 version);
 	bool loadFrame(int frame, bool loadCast);
 	bool readOneFrame();
+	void addKeyframe();
+	const ScoreKeyframe *findKeyframe(uint32 frameNum) const;
+	void restoreKeyframe(const ScoreKeyframe &keyframe);
 	void updateFrame(Frame *frame);
 	Frame *getFrameData(int frameNum);
 
@@ -168,6 +183,7 @@ public:
 	uint _firstFramePosition;
 	uint _framesStreamSize;
 	Common::MemoryReadStreamEndian *_framesStream;
+	Common::Array<ScoreKeyframe> _keyframes;
 
 	byte _currentFrameRate;
 	byte _puppetTempo;
@@ -145,6 +145,11 @@ private:
 	 */
 	const operandlist_t *fast_operandlist[0x80];
 
+	/**
+	 * Direct-mapped table of decoded instructions from ROM, indexed by the low bits of their address.
+	 */
+	decodedinst_t *decode_cache;
+
 	/**@}*/
 
 	/**
@@ -551,6 +556,24 @@ public:
 	*/
 	void parse_operands(oparg_t *opargs, const operandlist_t *oplist);
 
+	/**
+	 * Return the decoded form of the instruction at addr, decoding it if it isn't in the decode
+	 * cache. The address must be below ramstart; instructions running past ramstart are decoded
+	 * but not kept.
+	 */
+	const decodedinst_t *lookup_decoded(uint addr);
+
+	/**
+	 * Load the operand values of a decoded instruction into args, like parse_operands() does.
+	 * The PC is left alone.
+	 */
+	void load_decoded_operands(oparg_t *opargs, const decodedinst_t *decoded);
+
+	/**
+	 * Forget all decoded instructions. Called whenever memory below ramstart changes.
+	 */
+	void flush_decode_cache();
+
 	/**
 	 * Store a result value, according to the desttype and destaddress given. This is usually used to store
 	 * the result of an opcode, but it's also used by any code that pulls a call-stub off the stack.
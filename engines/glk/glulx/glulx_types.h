@@ -70,6 +70,13 @@ class Glulx;
  */
 #define SERIALIZE_CACHE_RAM (1)
 
+/**
+ * Comment this definition to turn off caching of decoded instructions. When on, the opcode and operand
+ * modes of instructions in ROM are decoded once and kept in a small direct-mapped table, so executing
+ * them again skips straight to loading the operand values.
+ */
+#define DECODE_CACHE (1)
+
 /**
  * Some macros to read and write integers to memory, always in big-endian format.
  */
@@ -88,12 +95,22 @@ class Glulx;
 #define VerifyW(adr, ln) (0)
 #endif /* VERIFY_MEMORY_ACCESS */
 
+/**
+ * Writes below ramstart aren't allowed by the spec. With memory-address checking on they are a
+ * fatal error, otherwise they go through and any decoded instructions have to be thrown away.
+ */
+#if defined(DECODE_CACHE) && !VERIFY_MEMORY_ACCESS
+#define VerifyCode(adr) ((adr) < ramstart ? flush_decode_cache() : (void)0)
+#else
+#define VerifyCode(adr) ((void)0)
+#endif
+
 #define Mem1(adr)  (Read1(memmap+(adr)))
 #define Mem2(adr)  (Read2(memmap+(adr)))
 #define Mem4(adr)  (Read4(memmap+(adr)))
-#define MemW1(adr, vl)  (VerifyW(adr, 1), Write1(memmap+(adr), (vl)))
-#define MemW2(adr, vl)  (VerifyW(adr, 2), Write2(memmap+(adr), (vl)))
-#define MemW4(adr, vl)  (VerifyW(adr, 4), Write4(memmap+(adr), (vl)))
+#define MemW1(adr, vl)  (VerifyW(adr, 1), VerifyCode(adr), Write1(memmap+(adr), (vl)))
+#define MemW2(adr, vl)  (VerifyW(adr, 2), VerifyCode(adr), Write2(memmap+(adr), (vl)))
+#define MemW4(adr, vl)  (VerifyW(adr, 4), VerifyCode(adr), Write4(memmap+(adr), (vl)))
 
 #ifndef _HUGE_ENUF
 #define _HUGE_ENUF  1e+300  // _HUGE_ENUF*_HUGE_ENUF must overflow
@@ -351,6 +368,49 @@ typedef oparg_struct oparg_t;
 
 #define MAX_OPERANDS (8)
 
+/**
+ * How the value of an operand of a decoded instruction is found. The first four are load
+ * operands, the rest store operands.
+ */
+enum decodedmode {
+	decodedmode_Constant = 0,   ///< value is the operand value
+	decodedmode_Pop = 1,        ///< Pop the operand value off the stack
+	decodedmode_Memory = 2,     ///< value is a main memory address
+	decodedmode_Locals = 3,     ///< value is an address in the locals segment
+	decodedmode_Discard = 4,    ///< Discard the stored value
+	decodedmode_StoreMemory = 5,
+	decodedmode_StoreLocals = 6,
+	decodedmode_Push = 7
+};
+
+/**
+ * Represents one operand of a decoded instruction, with any constant or address that followed
+ * the operand modes already read.
+ */
+struct decodedop_struct {
+	uint mode;              ///< One of the decodedmode values
+	uint value;
+};
+typedef decodedop_struct decodedop_t;
+
+/**
+ * Represents an instruction whose opcode and operand modes have already been decoded.
+ */
+struct decodedinst_struct {
+	uint addr;              ///< Address of the instruction, or DECODE_CACHE_EMPTY for an unused entry
+	uint opcode;
+	uint nextpc;            ///< Address of the following instruction
+	const operandlist_t *oplist;
+	decodedop_t ops[MAX_OPERANDS];
+};
+typedef decodedinst_struct decodedinst_t;
+
+/**
+ * Number of entries in the decoded instruction cache. This must be a power of two.
+ */
+#define DECODE_CACHE_SIZE (4096)
+#define DECODE_CACHE_EMPTY (0xFFFFFFFF)
+
 typedef uint(Glulx::*acceleration_func)(uint argc, uint *argv);
 
 struct accelentry_struct {
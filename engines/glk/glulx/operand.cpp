@@ -516,6 +516,246 @@ WrLocalsAddr:
 	}
 }
 
+#ifdef DECODE_CACHE
+
+void Glulx::flush_decode_cache() {
+	for (int ix = 0; ix < DECODE_CACHE_SIZE; ix++)
+		decode_cache[ix].addr = DECODE_CACHE_EMPTY;
+}
+
+const decodedinst_t *Glulx::lookup_decoded(uint addr) {
+	decodedinst_t *decoded = &decode_cache[addr & (DECODE_CACHE_SIZE - 1)];
+	if (decoded->addr == addr)
+		return decoded;
+
+	uint opcode;
+	const operandlist_t *oplist;
+	uint modeaddr = addr;
+
+	/* Fetch the opcode number, as execute_loop() does. */
+	opcode = Mem1(modeaddr);
+	modeaddr++;
+	if (opcode & 0x80) {
+		if (opcode & 0x40) {
+			opcode &= 0x3F;
+			opcode = (opcode << 8) | Mem1(modeaddr);
+			opcode = (opcode << 8) | Mem1(modeaddr + 1);
+			opcode = (opcode << 8) | Mem1(modeaddr + 2);
+			modeaddr += 3;
+		} else {
+			opcode &= 0x7F;
+			opcode = (opcode << 8) | Mem1(modeaddr);
+			modeaddr++;
+		}
+	}
+
+	if (opcode < 0x80)
+		oplist = fast_operandlist[opcode];
+	else
+		oplist = lookup_operandlist(opcode);
+
+	if (!oplist)
+		fatal_error_i("Encountered unknown opcode.", opcode);
+
+	/* Read the operand modes, and whatever constants or addresses follow them.
+	   This mirrors parse_operands(), without touching the stack or memory. */
+	int numops = oplist->num_ops;
+	uint curpc = modeaddr + (numops + 1) / 2;
+	int modeval = 0;
+	decodedop_t *curop = decoded->ops;
+
+	for (int ix = 0; ix < numops; ix++, curop++) {
+		int mode;
+		uint value = 0;
+
+		if ((ix & 1) == 0) {
+			modeval = Mem1(modeaddr);
+			mode = (modeval & 0x0F);
+		} else {
+			mode = ((modeval >> 4) & 0x0F);
+			modeaddr++;
+		}
+
+		switch (mode) {
+		case 1:
+			value = (int)(signed char)(Mem1(curpc));
+			curpc++;
+			break;
+		case 2:
+			value = (int)(signed char)(Mem1(curpc));
+			value = (value << 8) | (uint)(Mem1(curpc + 1));
+			curpc += 2;
+			break;
+		case 3:
+		case 7:
+		case 11:
+		case 15:
+			value = Mem4(curpc);
+			curpc += 4;
+			break;
+		case 6:
+		case 10:
+		case 14:
+			value = (uint)Mem2(curpc);
+			curpc += 2;
+			break;
+		case 5:
+		case 9:
+		case 13:
+			value = (uint)(Mem1(curpc));
+			curpc++;
+			break;
+		default:
+			break;
+		}
+
+		if (mode >= 13 && mode <= 15)
+			value += ramstart;
+
+		if (oplist->formlist[ix] == modeform_Load) {
+			switch (mode) {
+			case 0:
+			case 1:
+			case 2:
+			case 3:
+				curop->mode = decodedmode_Constant;
+				break;
+			case 8:
+				curop->mode = decodedmode_Pop;
+				break;
+			case 5:
+			case 6:
+			case 7:
+			case 13:
+			case 14:
+			case 15:
+				curop->mode = decodedmode_Memory;
+				break;
+			case 9:
+			case 10:
+			case 11:
+				curop->mode = decodedmode_Locals;
+				break;
+			default:
+				fatal_error("Unknown addressing mode in load operand.");
+			}
+		} else {
+			switch (mode) {
+			case 0:
+				curop->mode = decodedmode_Discard;
+				break;
+			case 8:
+				curop->mode = decodedmode_Push;
+				break;
+			case 5:
+			case 6:
+			case 7:
+			case 13:
+			case 14:
+			case 15:
+				curop->mode = decodedmode_StoreMemory;
+				break;
+			case 9:
+			case 10:
+			case 11:
+				curop->mode = decodedmode_StoreLocals;
+				break;
+			case 1:
+			case 2:
+			case 3:
+				fatal_error("Constant addressing mode in store operand.");
+				break;
+			default:
+				fatal_error("Unknown addressing mode in store operand.");
+			}
+		}
+
+		curop->value = value;
+	}
+
+	decoded->opcode = opcode;
+	decoded->oplist = oplist;
+	decoded->nextpc = curpc;
+
+	/* Only keep instructions lying entirely in ROM. */
+	decoded->addr = (curpc <= ramstart) ? addr : DECODE_CACHE_EMPTY;
+
+	return decoded;
+}
+
+void Glulx::load_decoded_operands(oparg_t *args, const decodedinst_t *decoded) {
+	int numops = decoded->oplist->num_ops;
+	int argsize = decoded->oplist->arg_size;
+	const decodedop_t *curop = decoded->ops;
+	oparg_t *curarg = args;
+	uint addr;
+
+	for (int ix = 0; ix < numops; ix++, curop++, curarg++) {
+		switch (curop->mode) {
+		case decodedmode_Constant:
+			curarg->desttype = 0;
+			curarg->value = curop->value;
+			break;
+
+		case decodedmode_Pop:
+			if (stackptr < valstackbase + 4) {
+				fatal_error("Stack underflow in operand.");
+			}
+			stackptr -= 4;
+			curarg->desttype = 0;
+			curarg->value = Stk4(stackptr);
+			break;
+
+		case decodedmode_Memory:
+			addr = curop->value;
+			curarg->desttype = 0;
+			if (argsize == 4) {
+				curarg->value = Mem4(addr);
+			} else if (argsize == 2) {
+				curarg->value = Mem2(addr);
+			} else {
+				curarg->value = Mem1(addr);
+			}
+			break;
+
+		case decodedmode_Locals:
+			addr = curop->value + localsbase;
+			curarg->desttype = 0;
+			if (argsize == 4) {
+				curarg->value = Stk4(addr);
+			} else if (argsize == 2) {
+				curarg->value = Stk2(addr);
+			} else {
+				curarg->value = Stk1(addr);
+			}
+			break;
+
+		case decodedmode_Discard:
+			curarg->desttype = 0;
+			curarg->value = 0;
+			break;
+
+		case decodedmode_StoreMemory:
+			curarg->desttype = 1;
+			curarg->value = curop->value;
+			break;
+
+		case decodedmode_StoreLocals:
+			curarg->desttype = 2;
+			curarg->value = curop->value;
+			break;
+
+		case decodedmode_Push:
+		default:
+			curarg->desttype = 3;
+			curarg->value = 0;
+			break;
+		}
+	}
+}
+
+#endif /* DECODE_CACHE */
+
 void Glulx::store_operand(uint desttype, uint destaddr, uint storeval) {
 	switch (desttype) {
 
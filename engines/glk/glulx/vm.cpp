@@ -87,6 +87,13 @@ void Glulx::setup_vm() {
 	}
 	stringtable = 0;
 
+#ifdef DECODE_CACHE
+	decode_cache = (decodedinst_t *)glulx_malloc(sizeof(decodedinst_t) * DECODE_CACHE_SIZE);
+	if (!decode_cache) {
+		fatal_error("Unable to allocate the instruction decode cache.");
+	}
+#endif /* DECODE_CACHE */
+
 	// Initialize various other things in the terp.
 	init_operands();
 	init_serial();
@@ -114,6 +121,10 @@ void Glulx::finalize_vm() {
 		glulx_free(stack);
 		stack = nullptr;
 	}
+	if (decode_cache) {
+		glulx_free(decode_cache);
+		decode_cache = nullptr;
+	}
 
 	final_serial();
 }
@@ -155,6 +166,11 @@ void Glulx::vm_restart() {
 		memmap[lx] = 0;
 	}
 
+#ifdef DECODE_CACHE
+	/* ROM may have been written to since it was last loaded. */
+	flush_decode_cache();
+#endif /* DECODE_CACHE */
+
 	/* Reset all the registers */
 	stackptr = 0;
 	frameptr = 0;
@@ -240,7 +240,10 @@ void TextBufferWindow::touchScroll() {
 	g_vm->_selection->clearSelection();
 	_windows->repaint(_bbox);
 
-	for (int i = 0; i < _scrollMax; i++)
+	// Only rows on screen when scrolled to the bottom check the dirty flag,
+	// and scrolling never brings a row further up back into that range
+	int lines = MIN(_scrollMax, _height);
+	for (int i = 0; i < lines; i++)
 		_lines[i]._dirty = true;
 }
 
@@ -1087,7 +1090,7 @@ void TextBufferWindow::redraw() {
 	 * draw the images
 	 */
 	for (i = 0; i < _scrollBack; i++) {
-		TextBufferRow ln(_lines[i]);
+		const TextBufferRow &ln = _lines[i];
 
 		y = y0 + (_height - (i - _scrollPos) - 1) * _font._leading;
 
@@ -1549,11 +1552,13 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lines[0]._len = _numChars;
 	_lines[0]._newLine = forced;
 
-	for (int i = _scrollBack - 1; i > 0; i--) {
-		memcpy(&_lines[i], &_lines[i - 1], sizeof(TextBufferRow));
-		if (i < _height)
-			touch(i);
-	}
+	// The top row of the scrollback is dropped, and reused as the new bottom row
+	_lines.rotate();
+	_chars = _lines[0]._chars;
+	_attrs = _lines[0]._attrs;
+
+	for (int i = MIN(_scrollBack, _height) - 1; i > 0; i--)
+		touch(i);
 
 	if (_radjn)
 		_radjn--;
@@ -1573,6 +1578,7 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lines[0]._rPic = nullptr;
 	_lines[0]._lHyper = 0;
 	_lines[0]._rHyper = 0;
+	_lines[0]._repaint = false;
 
 	Common::fill(_chars, _chars + TBLINELEN, ' ');
 	Attributes *a = _attrs;
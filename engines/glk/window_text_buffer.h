@@ -52,7 +52,53 @@ class TextBufferWindow : public TextWindow, Speech {
 		 */
 		TextBufferRow();
 	};
-	typedef Common::Array<TextBufferRow> TextBufferRows;
+
+	/**
+	 * The rows of the window, with the bottom row first. The rows are kept in a ring,
+	 * so scrolling a line only moves the start of the ring instead of copying every row
+	 * of the scrollback.
+	 */
+	class TextBufferRows {
+	private:
+		Common::Array<TextBufferRow> _rows;
+		uint _first;
+	public:
+		TextBufferRows() : _first(0) {}
+
+		TextBufferRow &operator[](uint idx) {
+			idx += _first;
+			return _rows[idx >= _rows.size() ? idx - _rows.size() : idx];
+		}
+
+		const TextBufferRow &operator[](uint idx) const {
+			idx += _first;
+			return _rows[idx >= _rows.size() ? idx - _rows.size() : idx];
+		}
+
+		uint size() const {
+			return _rows.size();
+		}
+
+		void clear() {
+			_rows.clear();
+			_first = 0;
+		}
+
+		/**
+		 * Resize the ring. Rows are only kept in order when the ring hasn't been rotated.
+		 */
+		void resize(uint newSize) {
+			assert(_first == 0);
+			_rows.resize(newSize);
+		}
+
+		/**
+		 * Move every row up by one. The old top row becomes the new bottom row.
+		 */
+		void rotate() {
+			_first = (_first == 0) ? _rows.size() - 1 : _first - 1;
+		}
+	};
 private:
 	PropFontInfo &_font;
 private:
@@ -26,6 +26,7 @@
 #include "engines/grim/debugger.h"
 #include "engines/grim/md5check.h"
 #include "engines/grim/grim.h"
+#include "engines/grim/resource.h"
 
 namespace Grim {
 
@@ -39,6 +40,7 @@ Debugger::Debugger() :
 	registerCmd("renderer_get", WRAP_METHOD(Debugger, cmd_renderer_get));
 	registerCmd("save", WRAP_METHOD(Debugger, cmd_save));
 	registerCmd("load", WRAP_METHOD(Debugger, cmd_load));
+	registerCmd("cache_stats", WRAP_METHOD(Debugger, cmd_cache_stats));
 }
 
 Debugger::~Debugger() {
@@ -134,4 +136,17 @@ bool Debugger::cmd_load(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmd_cache_stats(int argc, const char **argv) {
+	if (argc > 1 && !strcmp(argv[1], "reset")) {
+		g_resourceloader->resetCacheStats();
+		debugPrintf("Resource cache statistics reset.\n");
+		return true;
+	}
+
+	const ResourceLoader::CacheStats &stats = g_resourceloader->getCacheStats();
+	debugPrintf("Resource cache: %u entries, %u bytes\n", stats.entries, stats.memorySize);
+	debugPrintf("Hits: %u, misses: %u, evictions: %u\n", stats.hits, stats.misses, stats.evictions);
+	return true;
+}
+
 }
@@ -225,12 +225,47 @@ void EMIModel::setSkeleton(Skeleton *skel) {
 	for (int i = 0; i < _numBoneInfos; i++) {
 		_vertexBoneInfo[i] = _skeleton->findJointIndex(_boneNames[_boneInfos[i]._joint]);
 	}
+
+	delete[] _skinPose;
+	delete[] _skinMatrices;
+	_skinPose = new Math::Matrix4[_skeleton->_numJoints];
+	_skinMatrices = new Math::Matrix4[_skeleton->_numJoints];
+	_skinDirty = true;
+}
+
+bool EMIModel::updateSkinMatrices() {
+	const Joint *joints = _skeleton->_joints;
+	bool changed = _skinDirty;
+
+	for (int i = 0; i < _skeleton->_numJoints; i++) {
+		const Math::Matrix4 &jointMatrix = joints[i]._finalMatrix;
+		if (!changed && !memcmp(jointMatrix.getData(), _skinPose[i].getData(), 16 * sizeof(float)))
+			continue;
+
+		// The bind pose is a rotation and a translation, so its inverse
+		// undoes it like subtracting the position and applying the
+		// transposed rotation.
+		Math::Matrix4 invBindPose = joints[i]._absMatrix;
+		invBindPose.invertAffineOrthonormal();
+
+		_skinPose[i] = jointMatrix;
+		_skinMatrices[i] = jointMatrix * invBindPose;
+		changed = true;
+	}
+
+	_skinDirty = false;
+	return changed;
 }
 
 void EMIModel::prepareForRender() {
 	if (!_skeleton || !_vertexBoneInfo)
 		return;
 
+	// Models are drawn every frame, but most actors keep the same pose for
+	// many frames in a row. Only skin the vertices again when it changed.
+	if (!updateSkinMatrices())
+		return;
+
 	for (int i = 0; i < _numVertices; i++) {
 		_drawVertices[i].set(0.0f, 0.0f, 0.0f);
 		_drawNormals[i].set(0.0f, 0.0f, 0.0f);
@@ -242,20 +277,11 @@ void EMIModel::prepareForRender() {
 			boneVert++;
 		}
 
-		int jointIndex = _vertexBoneInfo[i];
-		const Math::Matrix4 &jointMatrix = _skeleton->_joints[jointIndex]._finalMatrix;
-		const Math::Matrix4 &bindPose = _skeleton->_joints[jointIndex]._absMatrix;
-
-		Math::Vector3d vert = _vertices[boneVert];
-		vert -= bindPose.getPosition();
-		vert = vert * bindPose.getRotation();
-		jointMatrix.transform(&vert, true);
-		_drawVertices[boneVert] += vert * _boneInfos[i]._weight;
+		const Math::Matrix4 &skinMatrix = _skinMatrices[_vertexBoneInfo[i]];
+		const float weight = _boneInfos[i]._weight;
 
-		Math::Vector3d normal = _normals[boneVert];
-		normal = normal * bindPose.getRotation();
-		jointMatrix.transform(&normal, false);
-		_drawNormals[boneVert] += normal * _boneInfos[i]._weight;
+		skinMatrix.transformWeighted(&_drawVertices[boneVert], _vertices[boneVert], weight, true);
+		skinMatrix.transformWeighted(&_drawNormals[boneVert], _normals[boneVert], weight, false);
 	}
 
 	for (int i = 0; i < _numVertices; i++) {
@@ -443,6 +469,9 @@ EMIModel::EMIModel(const Common::String &filename, Common::SeekableReadStream *d
 	_boneInfos = nullptr;
 	_numBoneInfos = 0;
 	_vertexBoneInfo = nullptr;
+	_skinPose = nullptr;
+	_skinMatrices = nullptr;
+	_skinDirty = true;
 	_skeleton = nullptr;
 	_radius = 0;
 	_center = new Math::Vector3d();
@@ -473,6 +502,8 @@ EMIModel::~EMIModel() {
 	delete[] _mats;
 	delete[] _boneInfos;
 	delete[] _vertexBoneInfo;
+	delete[] _skinPose;
+	delete[] _skinMatrices;
 	delete[] _boneNames;
 	delete[] _lighting;
 	delete[] _texFlags;
@@ -115,6 +115,12 @@ public:
 	Common::String *_boneNames;
 	int *_vertexBoneInfo;
 
+	// Per skeleton joint: the pose the draw vertices were last skinned with,
+	// and the matrix taking bind pose vertices to that pose.
+	Math::Matrix4 *_skinPose;
+	Math::Matrix4 *_skinMatrices;
+	bool _skinDirty;
+
 	// Stuff we dont know how to use:
 	float _radius;
 	Math::Vector3d *_center;
@@ -136,6 +142,7 @@ public:
 	void setSkeleton(Skeleton *skel);
 	void loadMesh(Common::SeekableReadStream *data);
 	void prepareForRender();
+	bool updateSkinMatrices();
 	void prepareTextures();
 	void draw();
 	void updateLighting(const Math::Matrix4 &modelToWorld);
@@ -71,9 +71,21 @@ public:
 	}
 };
 
+/**
+ * Stream over the data of a cache entry, which keeps the data alive
+ * until the stream is deleted even if the entry is evicted meanwhile.
+ */
+class CachedResourceStream : public Common::MemoryReadStream {
+public:
+	CachedResourceStream(const Common::SharedPtr<byte> &data, uint32 len) :
+		Common::MemoryReadStream(data.get(), len, DisposeAfterUse::NO), _data(data) {}
+
+private:
+	Common::SharedPtr<byte> _data;
+};
+
 ResourceLoader::ResourceLoader() {
-	_cacheDirty = false;
-	_cacheMemorySize = 0;
+	resetCacheStats();
 
 	Lab *l;
 	Common::ArchiveMemberList files, updFiles;
@@ -230,10 +242,8 @@ void clearList(Common::List<T> &list) {
 }
 
 ResourceLoader::~ResourceLoader() {
-	for (Common::Array<ResourceCache>::iterator i = _cache.begin(); i != _cache.end(); ++i) {
-		ResourceCache &r = *i;
-		delete[] r.fname;
-		delete[] r.resPtr;
+	for (ResourceCacheMap::iterator i = _cache.begin(); i != _cache.end(); ++i) {
+		delete i->_value;
 	}
 	clearList(_models);
 	clearList(_colormaps);
@@ -242,33 +252,29 @@ ResourceLoader::~ResourceLoader() {
 	MD5Check::clear();
 }
 
-static int sortCallback(const void *entry1, const void *entry2) {
-	return scumm_stricmp(((const ResourceLoader::ResourceCache *)entry1)->fname, ((const ResourceLoader::ResourceCache *)entry2)->fname);
-}
-
 Common::SeekableReadStream *ResourceLoader::getFileFromCache(const Common::Path &filename) const {
 	ResourceLoader::ResourceCache *entry = getEntryFromCache(filename);
-	if (!entry)
+	if (!entry) {
+		_cacheStats.misses++;
 		return nullptr;
+	}
 
-	return new Common::MemoryReadStream(entry->resPtr, entry->len);
+	_cacheStats.hits++;
+
+	// Move the entry to the front of the LRU list
+	_cacheLRU.erase(entry->lru);
+	_cacheLRU.push_front(entry);
+	entry->lru = _cacheLRU.begin();
+
+	return new CachedResourceStream(entry->resPtr, entry->len);
 }
 
 ResourceLoader::ResourceCache *ResourceLoader::getEntryFromCache(const Common::Path &filename) const {
-	if (_cache.empty())
+	ResourceCacheMap::const_iterator it = _cache.find(filename.toString('/'));
+	if (it == _cache.end())
 		return nullptr;
 
-	if (_cacheDirty) {
-		qsort(_cache.begin(), _cache.size(), sizeof(ResourceCache), sortCallback);
-		_cacheDirty = false;
-	}
-
-	Common::String sFilename(filename.toString('/'));
-
-	ResourceCache key;
-	key.fname = const_cast<char *>(sFilename.c_str());
-
-	return (ResourceLoader::ResourceCache *)bsearch(&key, _cache.begin(), _cache.size(), sizeof(ResourceCache), sortCallback);
+	return it->_value;
 }
 
 Common::SeekableReadStream *ResourceLoader::loadFile(const Common::Path &filename) const {
@@ -297,9 +303,11 @@ Common::SeekableReadStream *ResourceLoader::openNewStreamFile(const Common::Stri
 			uint32 size = s->size();
 			byte *buf = new byte[size];
 			s->read(buf, size);
-			putIntoCache(path, buf, size);
 			delete s;
-			s = new Common::MemoryReadStream(buf, size);
+			// The cache owns the buffer now, so share it with the stream
+			// in case the entry gets evicted while the stream is open.
+			ResourceCache *entry = putIntoCache(path, buf, size);
+			s = new CachedResourceStream(entry->resPtr, entry->len);
 		}
 	} else {
 		s = loadFile(path);
@@ -308,17 +316,62 @@ Common::SeekableReadStream *ResourceLoader::openNewStreamFile(const Common::Stri
 	return Common::wrapCompressedReadStream(s);
 }
 
-void ResourceLoader::putIntoCache(const Common::Path &fname, byte *res, uint32 len) const {
+ResourceLoader::ResourceCache *ResourceLoader::putIntoCache(const Common::Path &fname, byte *res, uint32 len) const {
 	Common::String sFilename(fname.toString('/'));
 
-	ResourceCache entry;
-	entry.resPtr = res;
-	entry.len = len;
-	entry.fname = new char[sFilename.size() + 1];
-	Common::strcpy_s(entry.fname, sFilename.size() + 1, sFilename.c_str());
-	_cacheMemorySize += len;
-	_cache.push_back(entry);
-	_cacheDirty = true;
+	ResourceCache *entry = getEntryFromCache(fname);
+	if (entry)
+		removeFromCache(entry);
+
+	// Make room for the new entry. A single file larger than the budget
+	// still gets cached, after everything else has been dropped.
+	while (!_cacheLRU.empty() && _cacheStats.memorySize + len > kCacheMaxMemorySize) {
+		ResourceCache *oldest = _cacheLRU.back();
+		Debug::debug(Debug::Engine, "ResourceLoader: Evicting %s (%u bytes) from the cache", oldest->fname.c_str(), oldest->len);
+		removeFromCache(oldest);
+		_cacheStats.evictions++;
+	}
+
+	entry = new ResourceCache();
+	entry->fname = sFilename;
+	entry->resPtr = Common::SharedPtr<byte>(res, Common::ArrayDeleter<byte>());
+	entry->len = len;
+	_cacheLRU.push_front(entry);
+	entry->lru = _cacheLRU.begin();
+	_cache[sFilename] = entry;
+
+	_cacheStats.entries++;
+	_cacheStats.memorySize += len;
+
+	return entry;
+}
+
+void ResourceLoader::removeFromCache(ResourceCache *entry) const {
+	_cache.erase(entry->fname);
+	_cacheLRU.erase(entry->lru);
+
+	_cacheStats.entries--;
+	_cacheStats.memorySize -= entry->len;
+
+	delete entry;
+}
+
+const ResourceLoader::CacheStats &ResourceLoader::getCacheStats() const {
+	return _cacheStats;
+}
+
+void ResourceLoader::resetCacheStats() {
+	// The entry count and memory size describe the current contents
+	// and are kept.
+	_cacheStats.hits = 0;
+	_cacheStats.misses = 0;
+	_cacheStats.evictions = 0;
+	_cacheStats.entries = _cache.size();
+	uint32 memorySize = 0;
+	for (ResourceCacheMap::const_iterator i = _cache.begin(); i != _cache.end(); ++i) {
+		memorySize += i->_value->len;
+	}
+	_cacheStats.memorySize = memorySize;
 }
 
 CMap *ResourceLoader::loadColormap(const Common::String &filename) {
@@ -602,22 +655,10 @@ Overlay *ResourceLoader::loadOverlay(const Common::String &filename) {
 void ResourceLoader::uncache(const Common::Path &filename) const {
 	Common::Path lower(filename);
 	lower.toLowercase();
-	Common::String fname(lower.toString('/'));
 
-	if (_cacheDirty) {
-		qsort(_cache.begin(), _cache.size(), sizeof(ResourceCache), sortCallback);
-		_cacheDirty = false;
-	}
-
-	for (unsigned int i = 0; i < _cache.size(); i++) {
-		if (fname.equals(_cache[i].fname)) {
-			delete[] _cache[i].fname;
-			_cacheMemorySize -= _cache[i].len;
-			delete[] _cache[i].resPtr;
-			_cache.remove_at(i);
-			_cacheDirty = true;
-		}
-	}
+	ResourceCache *entry = getEntryFromCache(lower);
+	if (entry)
+		removeFromCache(entry);
 }
 
 void ResourceLoader::uncacheModel(Model *m) {
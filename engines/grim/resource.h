@@ -24,6 +24,10 @@
 
 #include "common/archive.h"
 #include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/list.h"
+#include "common/ptr.h"
 
 #include "engines/grim/object.h"
 
@@ -86,23 +90,44 @@ public:
 	void uncacheAnimationEmi(AnimationEmi *a);
 
 	struct ResourceCache {
-		char *fname;
-		byte *resPtr;
+		Common::String fname;
+		// Streams handed out for the entry share the data, so that it
+		// can be evicted while they are still in use.
+		Common::SharedPtr<byte> resPtr;
 		uint32 len;
+		Common::List<ResourceCache *>::iterator lru;
 	};
 
+	struct CacheStats {
+		uint32 hits;
+		uint32 misses;
+		uint32 evictions;
+		uint32 entries;
+		uint32 memorySize;
+	};
+
+	const CacheStats &getCacheStats() const;
+	void resetCacheStats();
+
 	static Common::String fixFilename(const Common::String &filename, bool append = true);
 
 private:
 	Common::SeekableReadStream *loadFile(const Common::Path &filename) const;
 	Common::SeekableReadStream *getFileFromCache(const Common::Path &filename) const;
 	ResourceLoader::ResourceCache *getEntryFromCache(const Common::Path &filename) const;
-	void putIntoCache(const Common::Path &fname, byte *res, uint32 len) const;
+	ResourceLoader::ResourceCache *putIntoCache(const Common::Path &fname, byte *res, uint32 len) const;
 	void uncache(const Common::Path &fname) const;
+	void removeFromCache(ResourceCache *entry) const;
+
+	// Upper bound for the data kept in the cache. The least recently used
+	// entries are dropped to stay below it.
+	static const uint32 kCacheMaxMemorySize = 32 * 1024 * 1024;
 
-	mutable Common::Array<ResourceCache> _cache;
-	mutable bool _cacheDirty;
-	mutable int32 _cacheMemorySize;
+	typedef Common::HashMap<Common::String, ResourceCache *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> ResourceCacheMap;
+	mutable ResourceCacheMap _cache;
+	// Most recently used entries first
+	mutable Common::List<ResourceCache *> _cacheLRU;
+	mutable CacheStats _cacheStats;
 
 	Common::List<EMIModel *> _emiModels;
 	Common::List<Model *> _models;
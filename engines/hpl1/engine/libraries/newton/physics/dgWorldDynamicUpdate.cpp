@@ -898,14 +898,9 @@ void dgWorldDynamicUpdate::SpanningTree(dgBody *const body) {
 					if (bodyN->m_invMass.m_w > dgFloat32(0.0f)) {
 						queue.Insert(bodyN);
 					} else {
-
-						dgInt32 duplicateBody = 0;
-						for (; duplicateBody < staticCount; duplicateBody++) {
-							if (staticPool[duplicateBody] == srcBody) {
-								break;
-							}
-						}
-						if (duplicateBody == staticCount) {
+						// Each body is only visited once, so it can only be the
+						// last one added to the static pool
+						if (!staticCount || (staticPool[staticCount - 1] != srcBody)) {
 							staticPool[staticCount] = srcBody;
 							staticCount++;
 							NEWTON_ASSERT(srcBody->m_invMass.m_w > dgFloat32(0.0f));
@@ -934,13 +929,7 @@ void dgWorldDynamicUpdate::SpanningTree(dgBody *const body) {
 						NEWTON_ASSERT(constraint->m_body1);
 					}
 				} else if (cell.m_bodyNode->m_invMass.m_w == dgFloat32(0.0f)) {
-					dgInt32 duplicateBody = 0;
-					for (; duplicateBody < staticCount; duplicateBody++) {
-						if (staticPool[duplicateBody] == srcBody) {
-							break;
-						}
-					}
-					if (duplicateBody == staticCount) {
+					if (!staticCount || (staticPool[staticCount - 1] != srcBody)) {
 						staticPool[staticCount] = srcBody;
 						staticCount++;
 						NEWTON_ASSERT(srcBody->m_invMass.m_w > dgFloat32(0.0f));
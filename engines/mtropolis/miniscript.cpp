@@ -1735,7 +1735,9 @@ MiniscriptInstructionOutcome ListAppend::execute(MiniscriptThread *thread) const
 }
 
 MiniscriptInstructionOutcome PushValue::execute(MiniscriptThread *thread) const {
-	DynamicValue value;
+	thread->pushValue(DynamicValue());
+
+	DynamicValue &value = thread->getStackValueFromTop(0).value;
 
 	switch (_dataType) {
 	case DataType::kDataTypeNull:
@@ -1764,8 +1766,6 @@ MiniscriptInstructionOutcome PushValue::execute(MiniscriptThread *thread) const
 		break;
 	}
 
-	thread->pushValue(value);
-
 	return kMiniscriptInstructionOutcomeContinue;
 }
 
@@ -2058,7 +2058,7 @@ CORO_BEGIN_DEFINITION(MiniscriptThread::ResumeThreadCoroutine)
 		CORO_END_IF
 
 		CORO_WHILE (locals->self->_currentInstruction < locals->numInstrs && !locals->self->_failed)
-			CORO_AWAIT_MINISCRIPT(locals->self->runNextInstruction());
+			CORO_AWAIT_MINISCRIPT(locals->self->runInstructions());
 		CORO_END_WHILE
 	CORO_END_FUNCTION
 CORO_END_DEFINITION
@@ -2078,6 +2078,20 @@ MiniscriptInstructionOutcome MiniscriptThread::runNextInstruction() {
 	return outcome;
 }
 
+MiniscriptInstructionOutcome MiniscriptThread::runInstructions() {
+	// Run instructions directly until one of them needs the VThread to run a task,
+	// instead of stepping the coroutine once per instruction
+	const size_t numInstrs = _program->getInstructions().size();
+
+	while (_currentInstruction < numInstrs && !_failed) {
+		MiniscriptInstructionOutcome outcome = runNextInstruction();
+		if (outcome != kMiniscriptInstructionOutcomeContinue)
+			return outcome;
+	}
+
+	return kMiniscriptInstructionOutcomeContinue;
+}
+
 MiniscriptInstructionOutcome MiniscriptThread::tryLoadVariable(MiniscriptStackValue &stackValue) {
 	if (stackValue.value.getType() == DynamicValueTypes::kObject) {
 		Common::SharedPtr<RuntimeObject> obj = stackValue.value.getObject().object.lock();
@@ -457,6 +457,7 @@ private:
 	};
 
 	MiniscriptInstructionOutcome runNextInstruction();
+	MiniscriptInstructionOutcome runInstructions();
 
 	VThreadState resume(MiniscriptThread *thread);
 
@@ -277,10 +277,23 @@ void AkosRenderer::setPalette(uint16 *new_palette) {
 	}
 }
 
+AkosRenderer::~AkosRenderer() {
+	for (CelCacheList::iterator it = _celCacheLRU.begin(); it != _celCacheLRU.end(); ++it)
+		delete[] it->pixels;
+}
+
+void AkosRenderer::resetCelCacheStats() {
+	_celCacheStats.hits = 0;
+	_celCacheStats.misses = 0;
+	_celCacheStats.evictions = 0;
+}
+
 void AkosRenderer::setCostume(int costume, int shadow) {
 	const byte *akos = _vm->getResourceAddress(rtCostume, costume);
 	assert(akos);
 
+	_costume = costume;
+
 	_akhd = (const AkosHeader *)_vm->findResourceData(MKTAG('A','K','H','D'), akos);
 	_akof = (const AkosOffset *)_vm->findResourceData(MKTAG('A','K','O','F'), akos);
 	_akci = _vm->findResourceData(MKTAG('A','K','C','I'), akos);
@@ -603,6 +616,121 @@ void AkosRenderer::byleRLEDecode(ByleRLEData &dataBlock) {
 	} while (true);
 }
 
+const byte *AkosRenderer::getDecodedCel(const byte *celPtr, byte mask, byte shr) {
+	CelCacheKey key;
+	key.costume = _costume;
+	key.offset = celPtr - _akcd;
+
+	if (_celCache.contains(key)) {
+		CelCacheList::iterator it = _celCache[key];
+		DecodedCel cel = *it;
+
+		if (it != _celCacheLRU.begin()) {
+			_celCacheLRU.erase(it);
+			_celCacheLRU.push_front(cel);
+			_celCache[key] = _celCacheLRU.begin();
+		}
+
+		_celCacheStats.hits++;
+		return cel.pixels;
+	}
+
+	uint32 size = _width * _height;
+	if (!size || size > kCelCacheMaxCelSize)
+		return nullptr;
+
+	_celCacheStats.misses++;
+
+	// Same stream layout as in byleRLEDecode(): columns from top to bottom,
+	// runs continue into the next column, a zero length means 256 pixels.
+	DecodedCel cel;
+	cel.key = key;
+	cel.pixels = new byte[size];
+	cel.size = size;
+
+	const byte *src = celPtr;
+	uint32 pos = 0;
+
+	while (pos < size) {
+		byte color = *src >> shr;
+		uint32 len = *src++ & mask;
+
+		if (!len) {
+			len = *src++;
+			if (!len)
+				len = 256;
+		}
+
+		len = MIN(len, size - pos);
+		memset(cel.pixels + pos, color, len);
+		pos += len;
+	}
+
+	while (!_celCacheLRU.empty() && _celCacheStats.memorySize + size > kCelCacheMaxMemorySize) {
+		const DecodedCel &oldest = _celCacheLRU.back();
+
+		_celCache.erase(oldest.key);
+		_celCacheStats.memorySize -= oldest.size;
+		_celCacheStats.entries--;
+		_celCacheStats.evictions++;
+		delete[] oldest.pixels;
+		_celCacheLRU.pop_back();
+	}
+
+	_celCacheLRU.push_front(cel);
+	_celCache[key] = _celCacheLRU.begin();
+	_celCacheStats.memorySize += size;
+	_celCacheStats.entries++;
+
+	return cel.pixels;
+}
+
+// Equivalent to byleRLEDecode() for unscaled cels drawn without shadows and
+// outside of actor hit mode, reading the colors from an already decoded cel.
+void AkosRenderer::byleRLEDrawDecoded(ByleRLEData &dataBlock, const byte *pixels) {
+	const int xStart = _vm->_virtscr[kMainVirtScreen].xstart & 7;
+	const bool is16Bit = (_vm->_bytesPerPixel == 2);
+
+	// Only the rows inside the bounds rect are drawn
+	const int firstRow = MAX<int>(dataBlock.boundsRect.top - dataBlock.y, 0);
+	const int lastRow = MIN<int>(dataBlock.boundsRect.bottom - dataBlock.y, _height);
+
+	int columns = dataBlock.skipWidth;
+
+	while (true) {
+		if (dataBlock.x >= 0 && dataBlock.x < dataBlock.boundsRect.right && firstRow < lastRow) {
+			const byte maskbit = revBitMask(dataBlock.x & 7);
+			const byte *mask = _vm->getMaskBuffer(dataBlock.x - xStart, dataBlock.y + firstRow, _zbuf);
+			byte *dst = dataBlock.destPtr + firstRow * _out.pitch;
+
+			for (int row = firstRow; row < lastRow; row++) {
+				byte color = pixels[row];
+
+				if (color && !(*mask & maskbit)) {
+					if (is16Bit) {
+						WRITE_UINT16(dst, _palette[color]);
+					} else {
+						*dst = _palette[color];
+					}
+				}
+
+				dst += _out.pitch;
+				mask += _numStrips;
+			}
+		}
+
+		if (!--columns)
+			return;
+
+		pixels += _height;
+
+		dataBlock.x += dataBlock.scaleXStep;
+		if (dataBlock.x < 0 || dataBlock.x >= dataBlock.boundsRect.right)
+			return;
+		dataBlock.destPtr += dataBlock.scaleXStep * _vm->_bytesPerPixel;
+	}
+}
+
 const byte bigCostumeScaleTable[768] = {
 	0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0,
 	0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0,
@@ -875,13 +1003,21 @@ byte AkosRenderer::paintCelByleRLE(int xMoveCur, int yMoveCur) {
 
 	compData.repLen = 0;
 
+	// Unscaled cels without shadows can be drawn from the decoded cel cache
+	const byte *decodedPixels = nullptr;
+	if (!actorIsScaled && !_actorHitMode && _shadowMode == 0)
+		decodedPixels = getDecodedCel(_srcPtr, compData.mask, compData.shr);
+
 	if (_mirror) {
 		if (!actorIsScaled)
 			linesToSkip = compData.boundsRect.left - compData.x;
 
 		if (linesToSkip > 0) {
 			compData.skipWidth -= linesToSkip;
-			skipCelLines(compData, linesToSkip);
+			if (decodedPixels)
+				decodedPixels += linesToSkip * _height;
+			else
+				skipCelLines(compData, linesToSkip);
 			compData.x = compData.boundsRect.left;
 		} else {
 			linesToSkip = rect.right - compData.boundsRect.right;
@@ -896,7 +1032,10 @@ byte AkosRenderer::paintCelByleRLE(int xMoveCur, int yMoveCur) {
 			linesToSkip = rect.right - compData.boundsRect.right + 1;
 		if (linesToSkip > 0) {
 			compData.skipWidth -= linesToSkip;
-			skipCelLines(compData, linesToSkip)	;
+			if (decodedPixels)
+				decodedPixels += linesToSkip * _height;
+			else
+				skipCelLines(compData, linesToSkip);
 			compData.x = compData.boundsRect.right - 1;
 		} else {
 			linesToSkip = (compData.boundsRect.left -1) - rect.left;
@@ -932,7 +1071,10 @@ byte AkosRenderer::paintCelByleRLE(int xMoveCur, int yMoveCur) {
 	compData.height = _out.h;
 	compData.destPtr = (byte *)_out.getBasePtr(compData.x, compData.y);
 
-	byleRLEDecode(compData);
+	if (decodedPixels)
+		byleRLEDrawDecoded(compData, decodedPixels);
+	else
+		byleRLEDecode(compData);
 
 	return drawFlag;
 }
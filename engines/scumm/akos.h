@@ -22,6 +22,9 @@
 #ifndef SCUMM_AKOS_H
 #define SCUMM_AKOS_H
 
+#include "common/hashmap.h"
+#include "common/list.h"
+
 #include "scumm/base-costume.h"
 #include "scumm/he/wiz_he.h"
 
@@ -63,8 +66,46 @@ protected:
 };
 
 class AkosRenderer : public BaseCostumeRenderer {
+public:
+	struct CelCacheStats {
+		uint32 hits;
+		uint32 misses;
+		uint32 evictions;
+		uint32 entries;
+		uint32 memorySize;
+	};
+
 protected:
+	// Decoded BYLE RLE cels, so that unscaled actors which keep showing
+	// the same cel do not have to go through the RLE stream every frame.
+	static const uint32 kCelCacheMaxMemorySize = 2 * 1024 * 1024;
+	static const uint32 kCelCacheMaxCelSize = 256 * 1024;
+
+	struct CelCacheKey {
+		int costume;
+		uint32 offset;
+
+		bool operator==(const CelCacheKey &other) const { return costume == other.costume && offset == other.offset; }
+	};
+
+	struct CelCacheKey_Hash {
+		uint operator()(const CelCacheKey &key) const { return (uint)key.costume * 0x9E3779B1 ^ key.offset; }
+	};
+
+	struct DecodedCel {
+		CelCacheKey key;
+		byte *pixels;
+		uint32 size;
+	};
+
+	// Most recently used cels first
+	typedef Common::List<DecodedCel> CelCacheList;
+	CelCacheList _celCacheLRU;
+	Common::HashMap<CelCacheKey, CelCacheList::iterator, CelCacheKey_Hash> _celCache;
+	CelCacheStats _celCacheStats;
+
 	uint16 _codec;
+	int _costume;
 
 	// actor _palette
 	uint16 _palette[256];
@@ -109,7 +150,12 @@ public:
 		_rgbs = nullptr;
 		_xmap = nullptr;
 		_actorHitMode = false;
+		_costume = 0;
+		_celCacheStats.entries = 0;
+		_celCacheStats.memorySize = 0;
+		resetCelCacheStats();
 	}
+	~AkosRenderer() override;
 
 	bool _actorHitMode;
 	int16 _actorHitX, _actorHitY;
@@ -119,11 +165,16 @@ public:
 	void setFacing(const Actor *a) override;
 	void setCostume(int costume, int shadow) override;
 
+	const CelCacheStats &getCelCacheStats() const { return _celCacheStats; }
+	void resetCelCacheStats();
+
 protected:
 	byte drawLimb(const Actor *a, int limb) override;
 
 	byte paintCelByleRLE(int xMoveCur, int yMoveCur);
 	void byleRLEDecode(ByleRLEData &v1);
+	void byleRLEDrawDecoded(ByleRLEData &dataBlock, const byte *pixels);
+	const byte *getDecodedCel(const byte *celPtr, byte mask, byte shr);
 	byte paintCelCDATRLE(int xMoveCur, int yMoveCur);
 	byte paintCelMajMin(int xMoveCur, int yMoveCur);
 	byte paintCelTRLE(int actor, int drawToBack, int celX, int celY, int celWidth, int celHeight, byte tcolor, const byte *shadowTablePtr, int32 specialRenderFlags);
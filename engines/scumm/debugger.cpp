@@ -88,6 +88,9 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	registerCmd("scripts",   WRAP_METHOD(ScummDebugger, Cmd_PrintScript));
 	registerCmd("importres", WRAP_METHOD(ScummDebugger, Cmd_ImportRes));
 
+	if (_vm->_game.features & GF_NEW_COSTUMES)
+		registerCmd("celcache",  WRAP_METHOD(ScummDebugger, Cmd_CelCache));
+
 	if (_vm->_game.id == GID_LOOM)
 		registerCmd("drafts",  WRAP_METHOD(ScummDebugger, Cmd_PrintDraft));
 	if (_vm->_game.id == GID_INDY3)
@@ -1408,6 +1411,21 @@ bool ScummDebugger::Cmd_Passcode(int argc, const char **argv) {
 	return false;
 }
 
+bool ScummDebugger::Cmd_CelCache(int argc, const char **argv) {
+	AkosRenderer *renderer = (AkosRenderer *)_vm->_costumeRenderer;
+
+	if (argc > 1 && !strcmp(argv[1], "reset")) {
+		renderer->resetCelCacheStats();
+		return true;
+	}
+
+	const AkosRenderer::CelCacheStats &stats = renderer->getCelCacheStats();
+	debugPrintf("Decoded cel cache: %u hits, %u misses, %u evictions\n", stats.hits, stats.misses, stats.evictions);
+	debugPrintf("%u cels using %u bytes\n", stats.entries, stats.memorySize);
+
+	return true;
+}
+
 bool ScummDebugger::Cmd_ResetCursors(int argc, const char **argv) {
 	_vm->resetCursors();
 	detach();
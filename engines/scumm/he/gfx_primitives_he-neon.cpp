@@ -0,0 +1,89 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Vectorized versions of the transparent line transfers in gfx_primitives_he.cpp
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "scumm/he/intern_he.h"
+#include "scumm/he/wiz_he.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__)
+
+namespace Scumm {
+
+void Wiz::transparentLine8NEON(WizRawPixel8 *dstPtr, const WizRawPixel8 *srcPtr, int size, WizRawPixel8 transparentColor) {
+	const uint8x16_t key = vdupq_n_u8(transparentColor);
+
+	for (; size >= 16; size -= 16) {
+		const uint8x16_t src = vld1q_u8(srcPtr);
+		const uint8x16_t dst = vld1q_u8(dstPtr);
+		// Keep the destination where the source matches the transparent color
+		vst1q_u8(dstPtr, vbslq_u8(vceqq_u8(src, key), dst, src));
+
+		srcPtr += 16;
+		dstPtr += 16;
+	}
+
+	transparentLine8(dstPtr, srcPtr, size, transparentColor);
+}
+
+void Wiz::transparentLine16NEON(WizRawPixel16 *dstPtr, const WizRawPixel16 *srcPtr, int size, WizRawPixel16 transparentColor) {
+	const uint16x8_t key = vdupq_n_u16(transparentColor);
+
+	for (; size >= 8; size -= 8) {
+		const uint16x8_t src = vld1q_u16(srcPtr);
+		const uint16x8_t dst = vld1q_u16(dstPtr);
+		vst1q_u16(dstPtr, vbslq_u16(vceqq_u16(src, key), dst, src));
+
+		srcPtr += 8;
+		dstPtr += 8;
+	}
+
+	transparentLine16(dstPtr, srcPtr, size, transparentColor);
+}
+
+} // End of namespace Scumm
+
+#if !defined(__aarch64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__)
+
+#endif // SCUMMVM_NEON
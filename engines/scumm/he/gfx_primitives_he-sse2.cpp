@@ -0,0 +1,92 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Vectorized versions of the transparent line transfers in gfx_primitives_he.cpp
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_SSE2
+
+#include "scumm/he/intern_he.h"
+#include "scumm/he/wiz_he.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Scumm {
+
+// Keeps the destination where the source matches the transparent color
+static FORCEINLINE void transparentStore(void *dstPtr, __m128i src, __m128i mask) {
+	const __m128i dst = _mm_loadu_si128((const __m128i *)dstPtr);
+	_mm_storeu_si128((__m128i *)dstPtr, _mm_or_si128(_mm_and_si128(mask, dst), _mm_andnot_si128(mask, src)));
+}
+
+void Wiz::transparentLine8SSE2(WizRawPixel8 *dstPtr, const WizRawPixel8 *srcPtr, int size, WizRawPixel8 transparentColor) {
+	const __m128i key = _mm_set1_epi8((char)transparentColor);
+
+	for (; size >= 16; size -= 16) {
+		const __m128i src = _mm_loadu_si128((const __m128i *)srcPtr);
+		transparentStore(dstPtr, src, _mm_cmpeq_epi8(src, key));
+
+		srcPtr += 16;
+		dstPtr += 16;
+	}
+
+	transparentLine8(dstPtr, srcPtr, size, transparentColor);
+}
+
+void Wiz::transparentLine16SSE2(WizRawPixel16 *dstPtr, const WizRawPixel16 *srcPtr, int size, WizRawPixel16 transparentColor) {
+	const __m128i key = _mm_set1_epi16((short)transparentColor);
+
+	for (; size >= 8; size -= 8) {
+		const __m128i src = _mm_loadu_si128((const __m128i *)srcPtr);
+		transparentStore(dstPtr, src, _mm_cmpeq_epi16(src, key));
+
+		srcPtr += 8;
+		dstPtr += 8;
+	}
+
+	transparentLine16(dstPtr, srcPtr, size, transparentColor);
+}
+
+} // End of namespace Scumm
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
+
+#endif // SCUMMVM_SSE2
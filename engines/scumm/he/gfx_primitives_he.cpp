@@ -952,38 +952,28 @@ void Wiz::pgTransparentSimpleBlit(WizSimpleBitmap *destBM, Common::Rect *destRec
 
 	// Left or right?
 	if (sourceRect->left <= sourceRect->right) {
-		soff = sw - cw;
-		doff = dw - cw;
-
-		while (--ch >= 0) {
-			if (!_uses16BitColor) {
-				for (int x = cw; --x >= 0;) {
-					value = *s8++;
-
-					if (value != tColor) {
-						*d8++ = (WizRawPixel8)value;
-					} else {
-						d8++;
-					}
-				}
-
-				s8 += soff;
-				d8 += doff;
-			} else {
-				for (int x = cw; --x >= 0;) {
-					value = *s16++;
+		if (!_uses16BitColor && tColor > 0xFF) {
+			// No 8-bit pixel can match the transparent color
+			while (--ch >= 0) {
+				memcpy(d8, s8, cw * sizeof(WizRawPixel8));
 
-					if (value != tColor) {
-						*d16++ = (WizRawPixel16)value;
-					} else {
-						d16++;
-					}
-				}
+				s8 += sw;
+				d8 += dw;
+			}
+		} else if (!_uses16BitColor) {
+			while (--ch >= 0) {
+				_transparentLineFunc8(d8, s8, cw, (WizRawPixel8)tColor);
 
-				s16 += soff;
-				d16 += doff;
+				s8 += sw;
+				d8 += dw;
 			}
+		} else {
+			while (--ch >= 0) {
+				_transparentLineFunc16(d16, s16, cw, (WizRawPixel16)tColor);
 
+				s16 += sw;
+				d16 += dw;
+			}
 		}
 
 	} else {
@@ -1022,6 +1012,62 @@ void Wiz::pgTransparentSimpleBlit(WizSimpleBitmap *destBM, Common::Rect *destRec
 	}
 }
 
+// Initialize these to nullptr at the start
+Wiz::TransparentLineFunc8 Wiz::_transparentLineFunc8 = nullptr;
+Wiz::TransparentLineFunc16 Wiz::_transparentLineFunc16 = nullptr;
+
+void Wiz::initTransparentLineFuncs() {
+	_transparentLineFunc8 = transparentLine8;
+	_transparentLineFunc16 = transparentLine16;
+
+	// SSE2 and NEON are part of the baseline of x86-64 and AArch64, so
+	// there is no need to ask the backend about them there.
+#ifdef SCUMMVM_NEON
+#if defined(__aarch64__)
+	const bool hasNEON = true;
+#else
+	const bool hasNEON = g_system && g_system->hasFeature(OSystem::kFeatureCpuNEON);
+#endif
+	if (hasNEON) {
+		_transparentLineFunc8 = transparentLine8NEON;
+		_transparentLineFunc16 = transparentLine16NEON;
+	}
+#endif
+#ifdef SCUMMVM_SSE2
+#if defined(__x86_64__) || defined(_M_X64)
+	const bool hasSSE2 = true;
+#else
+	const bool hasSSE2 = g_system && g_system->hasFeature(OSystem::kFeatureCpuSSE2);
+#endif
+	if (hasSSE2) {
+		_transparentLineFunc8 = transparentLine8SSE2;
+		_transparentLineFunc16 = transparentLine16SSE2;
+	}
+#endif
+}
+
+void Wiz::transparentLine8(WizRawPixel8 *dstPtr, const WizRawPixel8 *srcPtr, int size, WizRawPixel8 transparentColor) {
+	while (--size >= 0) {
+		WizRawPixel8 value = *srcPtr++;
+
+		if (value != transparentColor)
+			*dstPtr = value;
+
+		dstPtr++;
+	}
+}
+
+void Wiz::transparentLine16(WizRawPixel16 *dstPtr, const WizRawPixel16 *srcPtr, int size, WizRawPixel16 transparentColor) {
+	while (--size >= 0) {
+		WizRawPixel16 value = *srcPtr++;
+
+		if (value != transparentColor)
+			*dstPtr = value;
+
+		dstPtr++;
+	}
+}
+
 void Wiz::pgDrawWarpDrawLetter(WizRawPixel *bitmapBuffer, int bitmapWidth, int bitmapHeight, const byte *charData, int x1, int y1, int width, int height, byte *colorLookupTable) {
 	WizRawPixel *remapTable = (_vm->_game.heversion <= 90) ? nullptr : (WizRawPixel *)_vm->getHEPaletteSlot(1);
 
@@ -87,7 +87,8 @@ public:
 	void setContainedObject(IContainedObject *value) { _contents = value; }
 	IContainedObject *getContainedObject() { return _contents; }
 
-	Common::Array<Node *> getChildren() const { return _children; }
+	const Common::Array<Node *> &getChildren() const { return _children; }
+	void addChild(Node *child) { _children.push_back(child); }
 	int generateChildren();
 	int generateNextChild();
 	Node *popChild();
@@ -27,10 +27,17 @@
 
 namespace Scumm {
 
-static int compareTreeNodes(const void *a, const void *b) {
-	if (((const TreeNode *)a)->value < ((const TreeNode *)b)->value)
+// The open lists are sorted in descending order, so that the best node
+// can be taken from the back without moving the rest of the array. Nodes
+// with the same value are taken in the order they were added.
+static int compareTreeNodes(const TreeNode &a, const TreeNode &b) {
+	if (a.value > b.value)
 		return -1;
-	else if (((const TreeNode *)a)->value > ((const TreeNode *)b)->value)
+	else if (a.value < b.value)
+		return 1;
+	else if (a.order > b.order)
+		return -1;
+	else if (a.order < b.order)
 		return 1;
 	else
 		return 0;
@@ -43,7 +50,8 @@ Tree::Tree(AI *ai) : _ai(ai) {
 	_currentNode = nullptr;
 	_currentChildIndex = 0;
 
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
+	_currentMap = new OpenList(compareTreeNodes);
+	_currentOrder = 0;
 }
 
 Tree::Tree(IContainedObject *contents, AI *ai) : _ai(ai) {
@@ -54,7 +62,8 @@ Tree::Tree(IContainedObject *contents, AI *ai) : _ai(ai) {
 	_currentNode = nullptr;
 	_currentChildIndex = 0;
 
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
+	_currentMap = new OpenList(compareTreeNodes);
+	_currentOrder = 0;
 }
 
 Tree::Tree(IContainedObject *contents, int maxDepth, AI *ai) : _ai(ai) {
@@ -65,7 +74,8 @@ Tree::Tree(IContainedObject *contents, int maxDepth, AI *ai) : _ai(ai) {
 	_currentNode = nullptr;
 	_currentChildIndex = 0;
 
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
+	_currentMap = new OpenList(compareTreeNodes);
+	_currentOrder = 0;
 }
 
 Tree::Tree(IContainedObject *contents, int maxDepth, int maxNodes, AI *ai) : _ai(ai) {
@@ -76,17 +86,18 @@ Tree::Tree(IContainedObject *contents, int maxDepth, int maxNodes, AI *ai) : _ai
 	_currentNode = nullptr;
 	_currentChildIndex = 0;
 
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
+	_currentMap = new OpenList(compareTreeNodes);
+	_currentOrder = 0;
 }
 
 void Tree::duplicateTree(Node *sourceNode, Node *destNode) {
 	Common::Array<Node *> vUnvisited = sourceNode->getChildren();
 
 	while (vUnvisited.size()) {
-		Node *newNode = new Node(*(vUnvisited.end()));
+		Node *newNode = new Node(vUnvisited.back());
 		newNode->setParent(destNode);
-		(destNode->getChildren()).push_back(newNode);
-		duplicateTree(*(vUnvisited.end()), newNode);
+		destNode->addChild(newNode);
+		duplicateTree(vUnvisited.back(), newNode);
 		vUnvisited.pop_back();
 	}
 }
@@ -95,7 +106,8 @@ Tree::Tree(const Tree *sourceTree, AI *ai) : _ai(ai) {
 	pBaseNode = new Node(sourceTree->getBaseNode());
 	_maxDepth = sourceTree->getMaxDepth();
 	_maxNodes = sourceTree->getMaxNodes();
-	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
+	_currentMap = new OpenList(compareTreeNodes);
+	_currentOrder = 0;
 	_currentNode = nullptr;
 	_currentChildIndex = 0;
 
@@ -124,7 +136,8 @@ Tree::~Tree() {
 }
 
 Node *Tree::aStarSearch() {
-	Common::SortedArray<TreeNode *> mmfpOpen(compareTreeNodes);
+	OpenList mmfpOpen(compareTreeNodes);
+	uint32 order = 0;
 
 	Node *currentNode = nullptr;
 	float currentT;
@@ -134,24 +147,24 @@ Node *Tree::aStarSearch() {
 	float temp = pBaseNode->getContainedObject()->calcT();
 
 	if (static_cast<int>(temp) != SUCCESS) {
-		mmfpOpen.insert(new TreeNode(pBaseNode->getObjectT(), pBaseNode));
+		mmfpOpen.insert(TreeNode(pBaseNode->getObjectT(), order++, pBaseNode));
 
 		while (mmfpOpen.size() && (retNode == nullptr)) {
-			currentNode = mmfpOpen.front()->node;
-			mmfpOpen.erase(mmfpOpen.begin());
+			currentNode = mmfpOpen.back().node;
+			mmfpOpen.pop_back();
 
 			if ((currentNode->getDepth() < _maxDepth) && (Node::getNodeCount() < _maxNodes)) {
 				// Generate nodes
-				Common::Array<Node *> vChildren = currentNode->getChildren();
+				const Common::Array<Node *> &vChildren = currentNode->getChildren();
 
-				for (Common::Array<Node *>::iterator i = vChildren.begin(); i != vChildren.end(); i++) {
+				for (Common::Array<Node *>::const_iterator i = vChildren.begin(); i != vChildren.end(); i++) {
 					IContainedObject *pTemp = (*i)->getContainedObject();
 					currentT = pTemp->calcT();
 
 					if (currentT == SUCCESS)
 						retNode = *i;
 					else
-						mmfpOpen.insert(new TreeNode(currentT, (*i)));
+						mmfpOpen.insert(TreeNode(currentT, order++, (*i)));
 				}
 			} else {
 				retNode = currentNode;
@@ -173,7 +186,7 @@ Node *Tree::aStarSearch_singlePassInit() {
 	float temp = pBaseNode->getContainedObject()->calcT();
 
 	if (static_cast<int>(temp) != SUCCESS) {
-		_currentMap->insert(new TreeNode(pBaseNode->getObjectT(), pBaseNode));
+		_currentMap->insert(TreeNode(pBaseNode->getObjectT(), _currentOrder++, pBaseNode));
 	} else {
 		retNode = pBaseNode;
 	}
@@ -197,8 +210,8 @@ Node *Tree::aStarSearch_singlePass() {
 			return retNode;
 		}
 
-		_currentNode = _currentMap->front()->node;
-		_currentMap->erase(_currentMap->begin());
+		_currentNode = _currentMap->back().node;
+		_currentMap->pop_back();
 	}
 
 	if ((_currentNode->getDepth() < _maxDepth) && (Node::getNodeCount() < _maxNodes) && ((!maxTime) || (_ai->getTimerValue(3) < maxTime))) {
@@ -206,14 +219,14 @@ Node *Tree::aStarSearch_singlePass() {
 		_currentChildIndex = _currentNode->generateChildren();
 
 		if (_currentChildIndex) {
-			Common::Array<Node *> vChildren = _currentNode->getChildren();
+			const Common::Array<Node *> &vChildren = _currentNode->getChildren();
 
 			if (!vChildren.size() && !_currentMap->size()) {
 				_currentChildIndex = 0;
 				retNode = _currentNode;
 			}
 
-			for (Common::Array<Node *>::iterator i = vChildren.begin(); i != vChildren.end(); i++) {
+			for (Common::Array<Node *>::const_iterator i = vChildren.begin(); i != vChildren.end(); i++) {
 				IContainedObject *pTemp = (*i)->getContainedObject();
 				currentT = pTemp->calcT();
 
@@ -221,7 +234,7 @@ Node *Tree::aStarSearch_singlePass() {
 					retNode = *i;
 					i = vChildren.end() - 1;
 				} else {
-					_currentMap->insert(new TreeNode(currentT, (*i)));
+					_currentMap->insert(TreeNode(currentT, _currentOrder++, (*i)));
 				}
 			}
 
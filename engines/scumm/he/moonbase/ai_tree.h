@@ -34,11 +34,14 @@ class AI;
 
 struct TreeNode {
 	float value;
+	uint32 order;
 	Node *node;
 
-	TreeNode(float v, Node *n) { value = v; node = n; }
+	TreeNode(float v, uint32 o, Node *n) { value = v; order = o; node = n; }
 };
 
+typedef Common::SortedArray<TreeNode, const TreeNode &> OpenList;
+
 class Tree {
 private:
 	Node *pBaseNode;
@@ -48,7 +51,8 @@ private:
 
 	int _currentChildIndex;
 
-	Common::SortedArray<TreeNode *> *_currentMap;
+	OpenList *_currentMap;
+	uint32 _currentOrder;
 	Node *_currentNode;
 
 	AI *_ai;
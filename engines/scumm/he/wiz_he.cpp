@@ -46,6 +46,10 @@ Wiz::Wiz(ScummEngine_v71he *vm) : _vm(vm) {
 	memset(&_polygons, 0, sizeof(_polygons));
 	_useWizClipRect = false;
 	_uses16BitColor = (_vm->_game.features & GF_16BIT_COLOR);
+
+	// If no line transfer function has been selected yet, detect and select
+	if (!_transparentLineFunc8)
+		initTransparentLineFuncs();
 }
 
 void Wiz::clearWizBuffer() {
@@ -816,6 +816,26 @@ public:
 private:
 	ScummEngine_v71he *_vm;
 
+	// Line transfer functions for pgTransparentSimpleBlit(), selected
+	// once at runtime depending on the available CPU extensions
+	typedef void (*TransparentLineFunc8)(WizRawPixel8 *dstPtr, const WizRawPixel8 *srcPtr, int size, WizRawPixel8 transparentColor);
+	typedef void (*TransparentLineFunc16)(WizRawPixel16 *dstPtr, const WizRawPixel16 *srcPtr, int size, WizRawPixel16 transparentColor);
+
+	static void initTransparentLineFuncs();
+	static TransparentLineFunc8 _transparentLineFunc8;
+	static TransparentLineFunc16 _transparentLineFunc16;
+
+	static void transparentLine8(WizRawPixel8 *dstPtr, const WizRawPixel8 *srcPtr, int size, WizRawPixel8 transparentColor);
+	static void transparentLine16(WizRawPixel16 *dstPtr, const WizRawPixel16 *srcPtr, int size, WizRawPixel16 transparentColor);
+#ifdef SCUMMVM_NEON
+	static void transparentLine8NEON(WizRawPixel8 *dstPtr, const WizRawPixel8 *srcPtr, int size, WizRawPixel8 transparentColor);
+	static void transparentLine16NEON(WizRawPixel16 *dstPtr, const WizRawPixel16 *srcPtr, int size, WizRawPixel16 transparentColor);
+#endif
+#ifdef SCUMMVM_SSE2
+	static void transparentLine8SSE2(WizRawPixel8 *dstPtr, const WizRawPixel8 *srcPtr, int size, WizRawPixel8 transparentColor);
+	static void transparentLine16SSE2(WizRawPixel16 *dstPtr, const WizRawPixel16 *srcPtr, int size, WizRawPixel16 transparentColor);
+#endif
+
 
 public:
 	/* Drawing Primitives
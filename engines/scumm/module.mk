@@ -184,6 +184,15 @@ MODULE_OBJS += \
 	he/moonbase/moonbase_fow.o \
 	he/moonbase/moonbase_gfx.o
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	he/gfx_primitives_he-neon.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	he/gfx_primitives_he-sse2.o
+endif
+
 ifdef USE_ENET
 MODULE_OBJS += \
 	dialog-createsession.o \
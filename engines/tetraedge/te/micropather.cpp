@@ -740,12 +740,18 @@ PathCache::~PathCache()
 
 
 void PathCache::Reset()
+{
+	Flush();
+	hit = 0;
+	miss = 0;
+}
+
+
+void PathCache::Flush()
 {
 	if ( nItems ) {
 		memset( mem, 0, sizeof(*mem)*allocated );
 		nItems = 0;
-		hit = 0;
-		miss = 0;
 	}
 }
 
@@ -753,7 +759,12 @@ void PathCache::Reset()
 void PathCache::Add( const Common::Array< void* >& path, const Common::Array< float >& cost )
 {
 	if ( nItems + (int)path.size() > allocated*3/4 ) {
-		return;
+		// Start over instead of not caching anything new once the cache
+		// is full, so characters walking to new targets still get cached paths.
+		if ( (int)path.size() > allocated*3/4 ) {
+			return;
+		}
+		Flush();
 	}
 
 	for( unsigned i=0; i<path.size()-1; ++i ) {
@@ -773,7 +784,10 @@ void PathCache::Add( const Common::Array< void* >& path, const Common::Array< fl
 void PathCache::AddNoSolution( void* end, void* states[], int count )
 {
 	if ( count + nItems > allocated*3/4 ) {
-		return;
+		if ( count > allocated*3/4 ) {
+			return;
+		}
+		Flush();
 	}
 
 	for( int i=0; i<count; ++i ) {
@@ -325,6 +325,7 @@ namespace micropather
 		~PathCache();
 
 		void Reset();
+		void Flush();	// Like Reset(), but keeps the hit and miss counts.
 		void Add( const Common::Array< void* >& path, const Common::Array< float >& cost );
 		void AddNoSolution( void* end, void* states[], int count );
 		int Solve( void* startState, void* endState, Common::Array< void* >* path, float* totalCost );
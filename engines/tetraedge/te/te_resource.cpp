@@ -36,6 +36,15 @@ TeResource::~TeResource() {
 	g_engine->getResourceManager()->removeResource(this);
 }
 
+void TeResource::setAccessName(const Common::Path &name) {
+	if (name == _accessName)
+		return;
+
+	const Common::Path oldName = _accessName;
+	_accessName = name;
+	g_engine->getResourceManager()->accessNameChanged(this, oldName);
+}
+
 void TeResource::generateAccessName() {
 	static char hexaChars[] = "0123456789ABCDEF";
 
@@ -39,9 +39,7 @@ public:
 		return _accessName;
 	}
 
-	void setAccessName(const Common::Path &name) {
-		_accessName = name;
-	}
+	void setAccessName(const Common::Path &name);
 
 private:
 	Common::Path _accessName;
@@ -37,30 +37,27 @@ TeResourceManager::~TeResourceManager() {
 
 void TeResourceManager::addResource(const TeIntrusivePtr<TeResource> &resource) {
 	_resources.insert_at(0, resource);
+	indexResource(_resources[0].get(), resource->getAccessName());
 }
 
 void TeResourceManager::addResource(TeResource *resource) {
-	_resources.insert_at(0, TeIntrusivePtr<TeResource>(resource));
+	addResource(TeIntrusivePtr<TeResource>(resource));
 }
 
 bool TeResourceManager::exists(const Common::Path &path) {
-	for (auto &resource : _resources) {
-		if (resource->getAccessName() == path)
-			return true;
-	}
-	return false;
+	return _resourcesByName.contains(path);
 }
 
 void TeResourceManager::removeResource(const TeIntrusivePtr<TeResource> &resource) {
-	for (uint i = 0; i < _resources.size(); i++) {
-		if (_resources[i] == resource) {
-			_resources.remove_at(i);
-			break;
-		}
-	}
+	removeResource(resource.get());
 }
 
 void TeResourceManager::removeResource(const TeResource *resource) {
+	// Most resources (eg, decoded images) are never registered, and
+	// those can be skipped without searching the list.
+	if (!_resourcesByName.contains(resource->getAccessName()))
+		return;
+
 	// We want to hold a new reference before removing the old one, as
 	// this could cause the object's destruction - which triggers it
 	// being removed from the list.
@@ -72,11 +69,69 @@ void TeResourceManager::removeResource(const TeResource *resource) {
 			break;
 		}
 	}
-	if (i < _resources.size())
+	if (i < _resources.size()) {
 		_resources.remove_at(i);
+		unindexResource(resource, resource->getAccessName());
+	}
 
 	// now we can let the other pointer go.  It could cause another
 	// removeResource request but now it's not in the list any more.
 }
 
+void TeResourceManager::accessNameChanged(TeResource *resource, const Common::Path &oldName) {
+	if (!_resourcesByName.contains(oldName) || !isRegistered(resource))
+		return;
+
+	unindexResource(resource, oldName);
+	indexResource(resource, resource->getAccessName());
+}
+
+TeResource *TeResourceManager::findResource(const Common::Path &path) const {
+	NamedResourceMap::const_iterator it = _resourcesByName.find(path);
+	if (it == _resourcesByName.end())
+		return nullptr;
+	return it->_value._resource;
+}
+
+bool TeResourceManager::isRegistered(const TeResource *resource) const {
+	for (const auto &registered : _resources) {
+		if (registered.get() == resource)
+			return true;
+	}
+	return false;
+}
+
+void TeResourceManager::indexResource(TeResource *resource, const Common::Path &name) {
+	// Lookups return the most recently added resource, as the list is
+	// searched from the front.
+	NamedResource &named = _resourcesByName.getOrCreateVal(name);
+	named._resource = resource;
+	named._count++;
+}
+
+void TeResourceManager::unindexResource(const TeResource *resource, const Common::Path &name) {
+	NamedResourceMap::iterator it = _resourcesByName.find(name);
+	if (it == _resourcesByName.end())
+		return;
+
+	NamedResource &named = it->_value;
+	if (--named._count == 0) {
+		_resourcesByName.erase(it);
+		return;
+	}
+
+	if (named._resource != resource)
+		return;
+
+	// Fall back to the next resource registered under the same name
+	named._resource = nullptr;
+	for (auto &other : _resources) {
+		if (other.get() != resource && other->getAccessName() == name) {
+			named._resource = other.get();
+			break;
+		}
+	}
+	assert(named._resource);
+}
+
 } // end namespace Tetraedge
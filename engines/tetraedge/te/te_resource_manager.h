@@ -23,6 +23,7 @@
 #define TETRAEDGE_TE_TE_RESOURCE_MANAGER_H
 
 #include "common/array.h"
+#include "common/hashmap.h"
 #include "common/path.h"
 #include "common/ptr.h"
 #include "common/file.h"
@@ -48,24 +49,23 @@ public:
 	bool exists(const Common::Path &path);
 	void removeResource(const TeIntrusivePtr<TeResource> &resource);
 	void removeResource(const TeResource *resource);
+	// Called by TeResource when its access name changes, so that
+	// registered resources can still be found under their new name.
+	void accessNameChanged(TeResource *resource, const Common::Path &oldName);
 
 	template<class T> TeIntrusivePtr<T> getResourceByName(const Common::Path &path) {
-		for (TeIntrusivePtr<TeResource> &resource : this->_resources) {
-			if (resource->getAccessName() == path) {
-				return TeIntrusivePtr<T>(dynamic_cast<T *>(resource.get()));
-			}
-		}
+		TeResource *resource = findResource(path);
+		if (resource)
+			return TeIntrusivePtr<T>(dynamic_cast<T *>(resource));
 		debug("getResourceByName: didn't find resource %s", path.toString(Common::Path::kNativeSeparator).c_str());
 		return TeIntrusivePtr<T>();
 	}
 
 	template<class T>
 	TeIntrusivePtr<T> getResource(const Common::Path &path) {
-		for (TeIntrusivePtr<TeResource> &resource : this->_resources) {
-			if (resource->getAccessName() == path) {
-				return TeIntrusivePtr<T>(dynamic_cast<T *>(resource.get()));
-			}
-		}
+		TeResource *resource = findResource(path);
+		if (resource)
+			return TeIntrusivePtr<T>(dynamic_cast<T *>(resource));
 
 		TeIntrusivePtr<T> retval = new T();
 
@@ -79,7 +79,20 @@ public:
 	}
 
 private:
+	struct NamedResource {
+		NamedResource() : _resource(nullptr), _count(0) {}
+		TeResource *_resource; // most recently added resource with this name
+		uint _count; // number of registered resources with this name
+	};
+	typedef Common::HashMap<Common::Path, NamedResource, Common::Path::Hash> NamedResourceMap;
+
+	TeResource *findResource(const Common::Path &path) const;
+	bool isRegistered(const TeResource *resource) const;
+	void indexResource(TeResource *resource, const Common::Path &name);
+	void unindexResource(const TeResource *resource, const Common::Path &name);
+
 	Common::Array<TeIntrusivePtr<TeResource>> _resources;
+	NamedResourceMap _resourcesByName;
 
 };
 
@@ -550,6 +550,8 @@ static void drawGeneral() {
 
 	ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
 	ImGui::Text("Draw time: %u ms", g_twp->_stats.drawTime);
+	const Gfx::Stats &gfxStats = g_twp->getGfx().getStats();
+	ImGui::Text("  Draw calls: %u, vertices: %u, batched draws: %u", gfxStats.drawCalls, gfxStats.vertices, gfxStats.batched);
 	ImGui::Text("Update time: %u ms", g_twp->_stats.totalUpdateTime);
 	ImGui::Text("  Update room time: %u ms", g_twp->_stats.updateRoomTime);
 	ImGui::Text("  Update tasks time: %u ms", g_twp->_stats.updateTasksTime);
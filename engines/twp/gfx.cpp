@@ -218,6 +218,7 @@ void Gfx::init() {
 }
 
 void Gfx::clear(const Color &color) {
+	flush();
 	glClearColor(color.rgba.r, color.rgba.g, color.rgba.b, color.rgba.a);
 	glClear(GL_COLOR_BUFFER_BIT);
 }
@@ -243,8 +244,60 @@ void Gfx::drawLinesLoop(Vertex *vertices, int count, const Math::Matrix4 &trsf)
 	drawPrimitives(GL_LINE_LOOP, vertices, count, trsf);
 }
 
+bool Gfx::canBatch(uint32 primitivesType) const {
+	return primitivesType == GL_TRIANGLES && _shader == &_defaultShader;
+}
+
+void Gfx::batch(const Vertex *vertices, int v_size, const uint32 *indices, int i_size, const Math::Matrix4 &trsf, Texture *texture) {
+	if (!texture)
+		texture = &_emptyTexture;
+	if (texture != _batchTexture)
+		flush();
+	_batchTexture = texture;
+
+	const uint32 base = _batchVertices.size();
+	const float *m = trsf.getData();
+	for (int i = 0; i < v_size; i++) {
+		const Vertex &v = vertices[i];
+		const float x = v.pos.getX();
+		const float y = v.pos.getY();
+		Vertex tv(v);
+		tv.pos.setX(m[0] * x + m[1] * y + m[3]);
+		tv.pos.setY(m[4] * x + m[5] * y + m[7]);
+		_batchVertices.push_back(tv);
+	}
+	for (int i = 0; i < i_size; i++) {
+		_batchIndices.push_back(base + (indices ? indices[i] : i));
+	}
+	_stats.batched++;
+}
+
+void Gfx::flush() {
+	if (_batchIndices.empty())
+		return;
+
+	drawElements(GL_TRIANGLES, _batchVertices.data(), _batchVertices.size(), _batchIndices.data(), _batchIndices.size(), Math::Matrix4(), _batchTexture);
+	_batchVertices.clear();
+	_batchIndices.clear();
+	_batchTexture = nullptr;
+}
+
+void Gfx::endFrame() {
+	flush();
+	_lastStats = _stats;
+	_stats = Stats();
+}
+
 void Gfx::drawPrimitives(uint32 primitivesType, Vertex *vertices, int v_size, const Math::Matrix4 &trsf, Texture *texture) {
+	if (v_size > 0 && canBatch(primitivesType)) {
+		batch(vertices, v_size, nullptr, v_size, trsf, texture);
+		return;
+	}
+
+	flush();
 	if (v_size > 0) {
+		_stats.drawCalls++;
+		_stats.vertices += v_size;
 		_texture = texture ? texture : &_emptyTexture;
 		GL_CALL(glBindTexture(GL_TEXTURE_2D, _texture->id));
 
@@ -277,6 +330,20 @@ void Gfx::drawPrimitives(uint32 primitivesType, Vertex *vertices, int v_size, co
 }
 
 void Gfx::drawPrimitives(uint32 primitivesType, Vertex *vertices, int v_size, uint32 *indices, int i_size, const Math::Matrix4 &trsf, Texture *texture) {
+	if (i_size <= 0)
+		return;
+
+	if (canBatch(primitivesType)) {
+		batch(vertices, v_size, indices, i_size, trsf, texture);
+	} else {
+		flush();
+		drawElements(primitivesType, vertices, v_size, indices, i_size, trsf, texture);
+	}
+}
+
+void Gfx::drawElements(uint32 primitivesType, const Vertex *vertices, int v_size, const uint32 *indices, int i_size, const Math::Matrix4 &trsf, Texture *texture) {
+	_stats.drawCalls++;
+	_stats.vertices += v_size;
 	if (i_size > 0) {
 		int num = _shader->getNumTextures();
 		if (num == 0) {
@@ -370,6 +437,7 @@ void Gfx::drawSprite(Texture &texture, const Color &color, const Math::Matrix4 &
 }
 
 void Gfx::camera(const Math::Vector2d &size) {
+	flush();
 	_cameraSize = size;
 	_mvp = ortho(0.f, size.getX(), 0.f, size.getY(), -1.f, 1.f);
 }
@@ -379,10 +447,12 @@ Math::Vector2d Gfx::camera() const {
 }
 
 void Gfx::use(Shader *shader) {
+	flush();
 	_shader = shader ? shader : &_defaultShader;
 }
 
 void Gfx::setRenderTarget(RenderTexture *target) {
+	flush();
 	if (!target) {
 		glBindFramebuffer(GL_FRAMEBUFFER, _oldFbo);
 		int w = g_twp->_system->getWidth();
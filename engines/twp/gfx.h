@@ -162,6 +162,13 @@ class Gfx {
 public:
 	friend class Shader;
 
+	// Drawing statistics of a frame
+	struct Stats {
+		uint32 drawCalls = 0;
+		uint32 vertices = 0;
+		uint32 batched = 0; // Number of draws merged into batches
+	};
+
 public:
 	void init();
 
@@ -184,9 +191,18 @@ public:
 	void drawSprite(const Common::Rect &textRect, Texture &texture, const Color &color = Color(), const Math::Matrix4 &trsf = Math::Matrix4(), bool flipX = false, bool flipY = false);
 	void drawSprite(Texture &texture, const Color &color = Color(), const Math::Matrix4 &trsf = Math::Matrix4(), bool flipX = false, bool flipY = false);
 
+	// Draws all the pending batched triangles
+	void flush();
+	void endFrame();
+	const Stats &getStats() const { return _lastStats; }
+
 private:
 	Math::Matrix4 getFinalTransform(const Math::Matrix4 &trsf);
 	void noTexture();
+	bool canBatch(uint32 primitivesType) const;
+	// Without indices, the vertices are drawn in order
+	void batch(const Vertex *vertices, int v_size, const uint32 *indices, int i_size, const Math::Matrix4 &trsf, Texture *texture);
+	void drawElements(uint32 primitivesType, const Vertex *vertices, int v_size, const uint32 *indices, int i_size, const Math::Matrix4 &trsf, Texture *texture);
 
 private:
 	Texture _emptyTexture;
@@ -199,6 +215,12 @@ private:
 	Textures _textures;
 	Texture *_texture = nullptr;
 	int _oldFbo = 0;
+	// Triangles drawn with the default shader and the same texture are merged,
+	// with their vertices already transformed
+	Common::Array<Vertex> _batchVertices;
+	Common::Array<uint32> _batchIndices;
+	Texture *_batchTexture = nullptr;
+	Stats _stats, _lastStats;
 };
 } // namespace Twp
 
@@ -578,6 +578,12 @@ bool RangeStream::seek(int64 offset, int whence) {
 	return _s->seek(offset, whence);
 }
 
+XorKey::XorKey(const Common::Array<int> &mb, int m) : magicBytes(mb), multiplier(m) {
+	for (int i = 0; i < 256; i++) {
+		schedule[i] = (byte)(magicBytes[i & 0x0F] ^ (i * multiplier));
+	}
+}
+
 XorStream::XorStream() : _s(nullptr), _size(0) {
 }
 
@@ -593,6 +599,26 @@ bool XorStream::open(Common::SeekableReadStream *stream, int len, const XorKey &
 uint32 XorStream::read(void *dataPtr, uint32 dataSize) {
 	int p = (int)pos();
 	uint32 result = _s->read(dataPtr, dataSize);
+	if ((p & 0x0F) == 0) {
+		// Each decoded byte only depends on the current and previous encoded bytes,
+		// so this can be done a word at a time with the precomputed key
+		byte *buf = (byte *)dataPtr;
+		uint32 previous = _previous & 0xFF;
+		uint32 i = 0;
+		for (; i + 4 <= dataSize; i += 4) {
+			uint32 x = READ_LE_UINT32(buf + i) ^ READ_LE_UINT32(_key.schedule + (i & 0xFF));
+			WRITE_LE_UINT32(buf + i, x ^ ((x << 8) | previous));
+			previous = x >> 24;
+		}
+		for (; i < dataSize; i++) {
+			uint32 x = buf[i] ^ _key.schedule[i & 0xFF];
+			buf[i] = (byte)(x ^ previous);
+			previous = x;
+		}
+		_previous = previous;
+		return result;
+	}
+
 	char *buf = (char *)dataPtr;
 	for (size_t i = 0; i < dataSize; i++) {
 		int x = buf[i] ^ _key.magicBytes[p & 0x0F] ^ (i * _key.multiplier);
@@ -665,9 +691,10 @@ bool GGPackDecoder::open(Common::SeekableReadStream *s, const XorKey &key) {
 GGPackEntryReader::GGPackEntryReader() {}
 
 bool GGPackEntryReader::open(GGPackDecoder &pack, const Common::String &entry) {
-	if (!pack._entries.contains(entry))
+	GGPackEntries::const_iterator it = pack._entries.find(entry);
+	if (it == pack._entries.end())
 		return false;
-	GGPackEntry e = pack._entries[entry];
+	const GGPackEntry &e = it->_value;
 	pack._s->seek(e.offset);
 
 	RangeStream rs;
@@ -33,10 +33,12 @@ namespace Twp {
 
 struct XorKey {
 	XorKey() {}
-	XorKey(const Common::Array<int> &mb, int m) : magicBytes(mb), multiplier(m) {}
+	XorKey(const Common::Array<int> &mb, int m);
 
 	Common::Array<int> magicBytes;
 	int multiplier = 0;
+	// Key bytes for the first 256 bytes of a read, the key repeats after that
+	byte schedule[256] = {};
 };
 
 class MemStream : public Common::SeekableReadStream {
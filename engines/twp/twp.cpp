@@ -818,6 +818,7 @@ void TwpEngine::draw(RenderTexture *outTexture) {
 
 	// imgui render
 	_gfx.use(nullptr);
+	_gfx.endFrame();
 	_system->updateScreen();
 }
 
@@ -50,6 +50,7 @@
 #include "ultima/ultima8/world/camera_process.h"
 #include "ultima/ultima8/world/get_object.h"
 #include "ultima/ultima8/world/item_factory.h"
+#include "ultima/ultima8/world/item_sorter.h"
 #include "ultima/ultima8/world/actors/quick_avatar_mover_process.h"
 #include "ultima/ultima8/world/actors/avatar_mover_process.h"
 #include "ultima/ultima8/world/actors/pathfinder.h"
@@ -100,6 +101,7 @@ Debugger::Debugger() : GUI::Debugger() {
 	registerCmd("GameMapGump::dumpAllMaps", WRAP_METHOD(Debugger, cmdDumpAllMaps));
 	registerCmd("GameMapGump::incrementSortOrder", WRAP_METHOD(Debugger, cmdIncrementSortOrder));
 	registerCmd("GameMapGump::decrementSortOrder", WRAP_METHOD(Debugger, cmdDecrementSortOrder));
+	registerCmd("GameMapGump::sortStats", WRAP_METHOD(Debugger, cmdSortStats));
 
 	registerCmd("Kernel::processTypes", WRAP_METHOD(Debugger, cmdProcessTypes));
 	registerCmd("Kernel::processInfo", WRAP_METHOD(Debugger, cmdProcessInfo));
@@ -820,6 +822,19 @@ bool Debugger::cmdDecrementSortOrder(int argc, const char **argv) {
 	return false;
 }
 
+bool Debugger::cmdSortStats(int argc, const char **argv) {
+	GameMapGump *gump = Ultima8Engine::get_instance()->getGameMapGump();
+	if (!gump || !gump->getDisplayList()) {
+		debugPrintf("No game map\n");
+		return true;
+	}
+
+	const ItemSorter::Stats &stats = gump->getDisplayList()->getStats();
+	debugPrintf("Items: %u, comparisons: %u, dependencies: %u, occluded: %u, painted: %u\n",
+				stats.items, stats.comparisons, stats.edges, stats.occluded, stats.painted);
+	return true;
+}
+
 
 bool Debugger::cmdProcessTypes(int argc, const char **argv) {
 	Kernel::get_instance()->processTypes();
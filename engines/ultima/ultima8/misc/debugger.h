@@ -76,6 +76,7 @@ private:
 	bool cmdDumpAllMaps(int argc, const char **argv);
 	bool cmdIncrementSortOrder(int argc, const char **argv);
 	bool cmdDecrementSortOrder(int argc, const char **argv);
+	bool cmdSortStats(int argc, const char **argv);
 
 	// Kernel
 	bool cmdProcessTypes(int argc, const char **argv);
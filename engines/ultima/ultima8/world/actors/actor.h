@@ -136,11 +136,16 @@ public:
 		return (_actorFlags & flags) != 0;
 	}
 	void setActorFlag(uint32 mask) {
+		// Kneeling changes the Crusader avatar's shape info, and so its height
+		if ((mask & ACT_KNEELING) && !(_actorFlags & ACT_KNEELING))
+			invalidateMapBounds();
 		_actorFlags |= mask;
 		if (mask & ACT_KNEELING)
 			_cachedShapeInfo = nullptr;
 	}
 	void clearActorFlag(uint32 mask) {
+		if ((mask & ACT_KNEELING) && (_actorFlags & ACT_KNEELING))
+			invalidateMapBounds();
 		_actorFlags &= ~mask;
 		if (mask & ACT_KNEELING)
 			_cachedShapeInfo = nullptr;
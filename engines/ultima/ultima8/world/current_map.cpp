@@ -51,7 +51,7 @@ typedef Std::list<Item *> item_list;
 const int INT_MAX_VALUE = 0x7fffffff;
 const int INT_MIN_VALUE = -INT_MAX_VALUE - 1;
 
-CurrentMap::CurrentMap() : _currentMap(0), _eggHatcher(0),
+CurrentMap::CurrentMap() : _currentMap(0), _boundsGeneration(1), _eggHatcher(0),
 	  _fastXMin(-1), _fastYMin(-1), _fastXMax(-1), _fastYMax(-1) {
 	for (unsigned int i = 0; i < MAP_NUM_CHUNKS; i++) {
 		memset(_fast[i], false, sizeof(uint32)*MAP_NUM_CHUNKS / 32);
@@ -85,6 +85,7 @@ void CurrentMap::clear() {
 		}
 		memset(_fast[i], false, sizeof(uint32)*MAP_NUM_CHUNKS / 32);
 	}
+	invalidateAllChunkBounds();
 
 	_fastXMin =  _fastYMin = _fastXMax = _fastYMax = -1;
 	_currentMap = nullptr;
@@ -152,6 +153,7 @@ void CurrentMap::writeback() {
 			_items[i][j].clear();
 		}
 	}
+	invalidateAllChunkBounds();
 
 	// delete _eggHatcher
 	Process *ehp = Kernel::get_instance()->getProcess(_eggHatcher);
@@ -257,6 +259,7 @@ void CurrentMap::addItem(Item *item) {
 #endif
 
 	_items[cx][cy].push_front(item);
+	_bounds[cx][cy]._generation = 0;
 	item->setExtFlag(Item::EXT_INCURMAP);
 
 	Egg *egg = dynamic_cast<Egg *>(item);
@@ -294,6 +297,7 @@ void CurrentMap::addItemToEnd(Item *item) {
 #endif
 
 	_items[cx][cy].push_back(item);
+	_bounds[cx][cy]._generation = 0;
 	item->setExtFlag(Item::EXT_INCURMAP);
 
 	Egg *egg = dynamic_cast<Egg *>(item);
@@ -405,9 +409,50 @@ void CurrentMap::removeItemFromList(Item *item, int32 oldx, int32 oldy) {
 	int32 cy = oldy / _mapChunkSize;
 
 	_items[cx][cy].remove(item);
+	_bounds[cx][cy]._generation = 0;
 	item->clearExtFlag(Item::EXT_INCURMAP);
 }
 
+void CurrentMap::invalidateChunkBounds(int32 x, int32 y) {
+	if (x < 0 || x >= _mapChunkSize * MAP_NUM_CHUNKS ||
+	        y < 0 || y >= _mapChunkSize * MAP_NUM_CHUNKS)
+		return;
+
+	_bounds[x / _mapChunkSize][y / _mapChunkSize]._generation = 0;
+}
+
+const CurrentMap::ChunkBounds &CurrentMap::getChunkBounds(int cx, int cy) const {
+	ChunkBounds &bounds = _bounds[cx][cy];
+	if (bounds._generation == _boundsGeneration)
+		return bounds;
+
+	bounds._items.clear();
+	bounds._objIds.clear();
+	bounds._shapeFlags.clear();
+	bounds._boxes.clear();
+
+	item_list::const_iterator iter;
+	for (iter = _items[cx][cy].begin(); iter != _items[cx][cy].end(); ++iter) {
+		const Item *item = *iter;
+		if (item->hasExtFlags(Item::EXT_SPRITE))
+			continue;
+
+		const ShapeInfo *si = item->getShapeInfo();
+		Point3 pt = item->getLocation();
+		int32 xd = 0, yd = 0, zd = 0;
+		if (si)
+			item->getFootpadWorld(xd, yd, zd);
+
+		bounds._items.push_back(item);
+		bounds._objIds.push_back(item->getObjId());
+		bounds._shapeFlags.push_back(si ? si->_flags : 0);
+		bounds._boxes.push_back(Box(pt.x, pt.y, pt.z, xd, yd, zd));
+	}
+
+	bounds._generation = _boundsGeneration;
+	return bounds;
+}
+
 // Check to see if the chunk is on the screen
 static inline bool ChunkOnScreen(int32 cx, int32 cy, int32 sleft, int32 stop, int32 sright, int32 sbot, int mapChunkSize) {
 	int32 scx = (cx * mapChunkSize - cy * mapChunkSize) / 4;
@@ -592,18 +637,13 @@ void CurrentMap::areaSearch(UCList *itemlist, const uint8 *loopscript,
 	//
 	for (int cy = miny; cy <= maxy; cy++) {
 		for (int cx = minx; cx <= maxx; cx++) {
-			item_list::const_iterator iter;
-			for (iter = _items[cx][cy].begin();
-			        iter != _items[cx][cy].end(); ++iter) {
-
-				const Item *item = *iter;
-
-				if (item->hasExtFlags(Item::EXT_SPRITE))
-					continue;
-
+			const ChunkBounds &bounds = getChunkBounds(cx, cy);
+			for (uint i = 0; i < bounds._items.size(); i++) {
 				// check if item is in range
-				Point3 pt = item->getLocation();
-				if (searchrange.containsXY(pt.x, pt.y)) {
+				const Box &ib = bounds._boxes[i];
+				if (searchrange.containsXY(ib._x, ib._y)) {
+					const Item *item = bounds._items[i];
+
 					// check item against loopscript
 					if (item->checkLoopScript(loopscript, scriptsize)) {
 						assert(itemlist->getElementSize() == 2);
@@ -639,20 +679,15 @@ void CurrentMap::surfaceSearch(UCList *itemlist, const uint8 *loopscript,
 
 	for (int cy = miny; cy <= maxy; cy++) {
 		for (int cx = minx; cx <= maxx; cx++) {
-			item_list::const_iterator iter;
-			for (iter = _items[cx][cy].begin();
-			        iter != _items[cx][cy].end(); ++iter) {
-
-				const Item *item = *iter;
-
-				if (item->getObjId() == check->getObjId())
-					continue;
-				if (item->hasExtFlags(Item::EXT_SPRITE))
+			const ChunkBounds &bounds = getChunkBounds(cx, cy);
+			for (uint i = 0; i < bounds._items.size(); i++) {
+				if (bounds._objIds[i] == check->getObjId())
 					continue;
 
 				// check if item is in range?
-				const Box ib = item->getWorldBox();
+				const Box &ib = bounds._boxes[i];
 				if (searchrange.overlapsXY(ib)) {
+					const Item *item = bounds._items[i];
 					bool ok = false;
 
 					if (above && ib._z == (searchrange._z + searchrange._zd)) {
@@ -738,23 +773,19 @@ PositionInfo CurrentMap::getPositionInfo(const Box &target, const Box &start, ui
 
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
-			item_list::const_iterator iter;
-			for (iter = _items[cx][cy].begin();
-				 iter != _items[cx][cy].end(); ++iter) {
-				const Item *item = *iter;
-				if (item->getObjId() == id)
-					continue;
-				if (item->hasExtFlags(Item::EXT_SPRITE))
-					continue;
-
-				const ShapeInfo *si = item->getShapeInfo();
-				if (!(si->_flags & flagmask))
+			const ChunkBounds &bounds = getChunkBounds(cx, cy);
+			for (uint i = 0; i < bounds._items.size(); i++) {
+				const uint32 siflags = bounds._shapeFlags[i];
+				if (!(siflags & flagmask))
 					continue; // not an interesting item
+				if (bounds._objIds[i] == id)
+					continue;
 
-				Box ib = item->getWorldBox();
+				const Item *item = bounds._items[i];
+				const Box &ib = bounds._boxes[i];
 
 				// check overlap
-				if ((si->_flags & shapeflags & blockmask) &&
+				if ((siflags & shapeflags & blockmask) &&
 					target.overlaps(ib) && !start.overlaps(ib)) {
 					// overlapping an item. Invalid position
 #if 0
@@ -767,12 +798,12 @@ PositionInfo CurrentMap::getPositionInfo(const Box &target, const Box &start, ui
 
 				if (target.overlapsXY(ib)) {
 					// check support
-					if (si->_flags & supportmask && ib._z + ib._zd > supportz && ib._z + ib._zd <= target._z) {
+					if (siflags & supportmask && ib._z + ib._zd > supportz && ib._z + ib._zd <= target._z) {
 						supportz = ib._z + ib._zd;
 					}
 
 					// check roof
-					if (si->is_roof() && ib._z < roofz && ib._z >= target._z + target._zd) {
+					if ((siflags & ShapeInfo::SI_ROOF) && ib._z < roofz && ib._z >= target._z + target._zd) {
 						info.roof = item;
 						roofz = ib._z;
 					}
@@ -781,7 +812,7 @@ PositionInfo CurrentMap::getPositionInfo(const Box &target, const Box &start, ui
 				// check bottom center
 				if (ib.isBelow(midx, midy, target._z)) {
 					// check land
-					if (si->_flags & landmask && ib._z + ib._zd > landz) {
+					if (siflags & landmask && ib._z + ib._zd > landz) {
 						info.land = item;
 						landz = ib._z + ib._zd;
 					}
@@ -852,22 +883,18 @@ bool CurrentMap::scanForValidPosition(int32 x, int32 y, int32 z, const Item *ite
 
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
-			for (item_list::const_iterator iter = _items[cx][cy].begin();
-			        iter != _items[cx][cy].end(); ++iter) {
-				const Item *citem = *iter;
-				if (citem->getObjId() == item->getObjId())
-					continue;
-				if (citem->hasExtFlags(Item::EXT_SPRITE))
-					continue;
-
-				const ShapeInfo *si = citem->getShapeInfo();
+			const ChunkBounds &bounds = getChunkBounds(cx, cy);
+			for (uint n = 0; n < bounds._items.size(); n++) {
+				const uint32 siflags = bounds._shapeFlags[n];
 				//!! need to check is_sea() and is_land() maybe?
-				if (!(si->_flags & blockflagmask))
+				if (!(siflags & blockflagmask))
 					continue; // not an interesting item
+				if (bounds._objIds[n] == item->getObjId())
+					continue;
 
-				int32 ixd, iyd, izd;
-				Point3 pt = citem->getLocation();
-				citem->getFootpadWorld(ixd, iyd, izd);
+				const Box &ib = bounds._boxes[n];
+				const Point3 pt(ib._x, ib._y, ib._z);
+				const int32 ixd = ib._xd, iyd = ib._yd, izd = ib._zd;
 
 				int minv = pt.z - z - zd + 1;
 				int maxv = pt.z + izd - z - 1;
@@ -906,7 +933,7 @@ bool CurrentMap::scanForValidPosition(int32 x, int32 y, int32 z, const Item *ite
 					for (int i = minh; i <= maxh; ++i)
 						validmask[j + scansize] &= ~(1 << (i + scansize));
 
-				if (wantsupport && si->is_solid() &&
+				if (wantsupport && (siflags & ShapeInfo::SI_SOLID) &&
 				        pt.z + izd >= z - scansize && pt.z + izd <= z + scansize) {
 					for (int i = minh; i <= maxh; ++i)
 						supportmask[pt.z + izd - z + scansize] |= (1 << (i + scansize));
@@ -1036,16 +1063,13 @@ bool CurrentMap::sweepTest(const Point3 &start, const Point3 &end,
 
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
-			item_list::const_iterator iter;
-			for (iter = _items[cx][cy].begin();
-			        iter != _items[cx][cy].end(); ++iter) {
-				const Item *other_item = *iter;
-				if (other_item->getObjId() == item)
-					continue;
-				if (other_item->hasExtFlags(Item::EXT_SPRITE))
+			const ChunkBounds &bounds = getChunkBounds(cx, cy);
+			for (uint n = 0; n < bounds._items.size(); n++) {
+				const ObjId other_id = bounds._objIds[n];
+				if (other_id == item)
 					continue;
 
-				uint32 othershapeflags = other_item->getShapeInfo()->_flags;
+				uint32 othershapeflags = bounds._shapeFlags[n];
 				bool blocking = (othershapeflags & shapeflags &
 				                 blockflagmask) != 0;
 
@@ -1055,11 +1079,13 @@ bool CurrentMap::sweepTest(const Point3 &start, const Point3 &end,
 					continue;
 
 				int32 other[3], oext[3];
-				Point3 opt = other_item->getLocation();
-				other[0] = opt.x;
-				other[1] = opt.y;
-				other[2] = opt.z;
-				other_item->getFootpadWorld(oext[0], oext[1], oext[2]);
+				const Box &ob = bounds._boxes[n];
+				other[0] = ob._x;
+				other[1] = ob._y;
+				other[2] = ob._z;
+				oext[0] = ob._xd;
+				oext[1] = ob._yd;
+				oext[2] = ob._zd;
 
 				// If the objects overlapped at the start, ignore collision.
 				// The -1 and +1 portions are to still consider collisions
@@ -1200,10 +1226,10 @@ bool CurrentMap::sweepTest(const Point3 &start, const Point3 &end,
 					}
 
 					// Now add it
-					hit->insert(sw_it, SweepItem(other_item->getObjId(), first, last, touch, touch_floor, blocking, dirs));
+					hit->insert(sw_it, SweepItem(other_id, first, last, touch, touch_floor, blocking, dirs));
 
 					//debugC(kDebugCollision, "Hit item %u (%d, %d, %d) at first: %d, last: %d",
-					//	   other_item->getObjId(), other[0], other[1], other[2], first, last);
+					//	   other_id, other[0], other[1], other[2], first, last);
 					//debugC(kDebugCollision, "hit item time (%d-%d) (%d-%d) (%d-%d)",
 					//	u_0[0], u_1[0], u_0[1], u_1[1], u_0[2], u_1[2]);
 					//debugC(kDebugCollision, "touch: %d, floor: %d, block: %d", touch, touch_floor, blocking);
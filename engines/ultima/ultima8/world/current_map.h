@@ -22,16 +22,17 @@
 #ifndef ULTIMA8_WORLD_CURRENTMAP_H
 #define ULTIMA8_WORLD_CURRENTMAP_H
 
+#include "common/array.h"
 #include "ultima/shared/std/containers.h"
 #include "ultima/ultima8/usecode/intrinsics.h"
 #include "ultima/ultima8/world/position_info.h"
+#include "ultima/ultima8/misc/box.h"
 #include "ultima/ultima8/misc/direction.h"
 #include "ultima/ultima8/misc/point3.h"
 
 namespace Ultima {
 namespace Ultima8 {
 
-struct Box;
 class Map;
 class Item;
 class UCList;
@@ -73,6 +74,15 @@ public:
 	void removeItemFromList(Item *item, int32 oldx, int32 oldy);
 	void removeItem(Item *item);
 
+	//! Mark the cached item bounds of the chunk containing (x, y) as stale.
+	//! Must be called before the world box of an item in that chunk changes.
+	void invalidateChunkBounds(int32 x, int32 y);
+
+	//! Mark the cached item bounds of all chunks as stale
+	void invalidateAllChunkBounds() {
+		_boundsGeneration++;
+	}
+
 	//! Add an item to the list of possible targets (in Crusader)
 	void addTargetItem(const Item *item);
 	//! Remove an item from the list of possible targets (in Crusader)
@@ -199,12 +209,33 @@ private:
 	//! clip the given map chunk numbers to iterate over them safely
 	static void clipMapChunks(int &minx, int &maxx, int &miny, int &maxy);
 
+	//! Packed copy of the world boxes and shape flags of the items in a
+	//! chunk, in item list order. Sprites are left out, as no query looks
+	//! at them. This lets the collision and search queries reject most
+	//! items without touching the Item objects.
+	struct ChunkBounds {
+		ChunkBounds() : _generation(0) { }
+
+		Common::Array<const Item *> _items;
+		Common::Array<ObjId> _objIds;
+		Common::Array<uint32> _shapeFlags;
+		Common::Array<Box> _boxes;
+		uint32 _generation; // Valid if equal to _boundsGeneration
+	};
+
+	//! Get the item bounds of a chunk, rebuilding them if stale
+	const ChunkBounds &getChunkBounds(int cx, int cy) const;
+
 	Map *_currentMap;
 
 	// item lists. Lots of them :-)
 	// items[x][y]
 	Std::list<Item *> _items[MAP_NUM_CHUNKS][MAP_NUM_CHUNKS];
 
+	// Item bounds for each of the item lists, built on demand
+	mutable ChunkBounds _bounds[MAP_NUM_CHUNKS][MAP_NUM_CHUNKS];
+	uint32 _boundsGeneration;
+
 	ProcId _eggHatcher;
 
 	// Fast area bit masks -> fast[ry][rx/32]&(1<<(rx&31));
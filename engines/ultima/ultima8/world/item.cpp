@@ -146,12 +146,20 @@ const Item *Item::getTopItem() const {
 }
 
 void Item::setLocation(int32 X, int32 Y, int32 Z) {
+	// The item may end up outside the chunk it is listed in
+	if (_extendedFlags & EXT_INCURMAP)
+		World::get_instance()->getCurrentMap()->invalidateAllChunkBounds();
+
 	_x = X;
 	_y = Y;
 	_z = Z;
 }
 
 void Item::setLocation(const Point3 &pt) {
+	// The item may end up outside the chunk it is listed in
+	if (_extendedFlags & EXT_INCURMAP)
+		World::get_instance()->getCurrentMap()->invalidateAllChunkBounds();
+
 	_x = pt.x;
 	_y = pt.y;
 	_z = pt.z;
@@ -210,6 +218,9 @@ void Item::move(int32 X, int32 Y, int32 Z) {
 	// Unset all the various _flags that no longer apply
 	_flags &= ~(FLG_CONTAINED | FLG_EQUIPPED | FLG_ETHEREAL);
 
+	// Still in the same map chunk
+	invalidateMapBounds();
+
 	// Set the location
 	_x = X;
 	_y = Y;
@@ -482,6 +493,9 @@ Box Item::getWorldBox() const {
 void Item::setShape(uint32 shape) {
 	_cachedShape = nullptr;
 
+	if (shape != _shape)
+		invalidateMapBounds();
+
 	if (GAME_IS_CRUSADER && _shape && shape != _shape) {
 		// In Crusader, here we need to check if the shape
 		// changed from targetable to not-targetable, or vice-versa
@@ -504,6 +518,11 @@ void Item::setShape(uint32 shape) {
 	}
 }
 
+void Item::invalidateMapBounds() const {
+	if (_extendedFlags & EXT_INCURMAP)
+		World::get_instance()->getCurrentMap()->invalidateChunkBounds(_x, _y);
+}
+
 bool Item::overlaps(const Item &item2) const {
 	int32 x1a, y1a, z1b;
 	int32 x2a, y2a, z2b;
@@ -3021,7 +3040,7 @@ uint32 Item::I_andStatus(const uint8 *args, unsigned int argsize) {
 	ARG_UINT16(mask);
 	if (!item) return 0;
 
-	item->_flags &= mask;
+	item->clearFlag(static_cast<uint16>(~mask));
 	return 0;
 }
 
@@ -152,6 +152,8 @@ public:
 
 	//! Set the flags set in the given mask.
 	void setFlag(uint32 mask) {
+		if ((mask & FLG_FLIPPED) && !(_flags & FLG_FLIPPED))
+			invalidateMapBounds();
 		_flags |= mask;
 	}
 
@@ -161,6 +163,8 @@ public:
 
 	//! Clear the flags set in the given mask.
 	void clearFlag(uint32 mask) {
+		if ((mask & FLG_FLIPPED) && (_flags & FLG_FLIPPED))
+			invalidateMapBounds();
 		_flags &= ~mask;
 	}
 
@@ -656,6 +660,10 @@ protected:
 	//! and the type of object this is.
 	int scaleReceivedDamageCru(int damage, uint16 type) const;
 
+	//! Tell the CurrentMap that the world box of this item is about to
+	//! change, if the item is in it.
+	void invalidateMapBounds() const;
+
 private:
 
 	//! Call a Usecode Event. Use the separate functions instead!
@@ -39,16 +39,34 @@
 
 #include "ultima/ultima8/world/sort_item.h"
 
+#include "common/algorithm.h"
+
 namespace Ultima {
 namespace Ultima8 {
 
 static const uint32 TRANSPARENT_COLOR = TEX32_PACK_RGBA(0x7F, 0x00, 0x00, 0x7F);
 static const uint32 HIGHLIGHT_COLOR = TEX32_PACK_RGBA(0xFF, 0xFF, 0x00, 0x1F);
 
+/**
+ * Order of the paint list. Items that compare equal keep the order in
+ * which they were added, matching an insertion sort of the list.
+ */
+static bool listOrderLess(const SortItem *si1, const SortItem *si2) {
+	if (si1->listLessThan(*si2))
+		return true;
+	if (si2->listLessThan(*si1))
+		return false;
+	return si1->_addIndex < si2->_addIndex;
+}
+
 ItemSorter::ItemSorter(int capacity) :
 	_shapes(nullptr), _clipWindow(0, 0, 0, 0), _items(nullptr), _itemsTail(nullptr),
 	_itemsUnused(nullptr), _painted(nullptr), _camSx(0), _camSy(0),
+	_itemListSorted(true), _cellCols(0), _cellRows(0),
 	_sortLimit(0), _sortLimitChanged(false) {
+	memset(&_stats, 0, sizeof(_stats));
+	_itemList.reserve(capacity);
+
 	int i = capacity;
 	while (i--) {
 		SortItem *next = _itemsUnused;
@@ -58,10 +76,11 @@ ItemSorter::ItemSorter(int capacity) :
 }
 
 ItemSorter::~ItemSorter() {
-	if (_itemsTail) {
-		_itemsTail->_next = _itemsUnused;
-		_itemsUnused = _items;
+	for (uint i = 0; i < _itemList.size(); i++) {
+		_itemList[i]->_next = _itemsUnused;
+		_itemsUnused = _itemList[i];
 	}
+	_itemList.clear();
 	_items = nullptr;
 	_itemsTail = nullptr;
 
@@ -79,15 +98,32 @@ void ItemSorter::BeginDisplayList(const Rect &clipWindow, const Point3 &cam) {
 	// Set the clip window, and reset the item list
 	_clipWindow = clipWindow;
 
-	if (_itemsTail) {
-		_itemsTail->_next = _itemsUnused;
-		_itemsUnused = _items;
+	for (uint i = 0; i < _itemList.size(); i++) {
+		_itemList[i]->_next = _itemsUnused;
+		_itemsUnused = _itemList[i];
 	}
+	_itemList.clear();
+	_itemListSorted = true;
 
 	_items = nullptr;
 	_itemsTail = nullptr;
 	_painted = nullptr;
 
+	memset(&_stats, 0, sizeof(_stats));
+
+	// Size the overlap grid to the clip window
+	int32 cols = MAX<int32>(1, (clipWindow.width() + kCellSize - 1) / kCellSize);
+	int32 rows = MAX<int32>(1, (clipWindow.height() + kCellSize - 1) / kCellSize);
+	if (cols != _cellCols || rows != _cellRows) {
+		_cellCols = cols;
+		_cellRows = rows;
+		_cells.clear();
+		_cells.resize(cols * rows);
+	} else {
+		for (uint i = 0; i < _cells.size(); i++)
+			_cells[i].clear();
+	}
+
 	// Screenspace bounding box bottom x coord (RNB x coord)
 	int32 camSx = (cam.x - cam.y) / 4;
 	// Screenspace bounding box bottom extent  (RNB y coord)
@@ -187,18 +223,44 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 	// are never deleted
 	si->_depends.clear();
 
-	// Iterate the list and compare _shapes
+	si->_addIndex = _itemList.size() + 1;
+	si->_visitIndex = 0;
+
+	// Collect the items sharing a grid cell with us. Items whose screenspace
+	// rects intersect always share at least one cell, so nothing else can
+	// overlap. They are compared in paint list order, as the occlusion
+	// checks below depend on it.
+	int32 cx0, cy0, cx1, cy1;
+	GetCellRange(si, cx0, cy0, cx1, cy1);
+
+	_candidates.clear();
+#ifdef SORTITEM_OCCLUSION_EXPERIMENTAL
+	// Adjoining items need not overlap on screen, so compare against everything
+	_candidates.push_back(_itemList);
+#else
+	for (int32 cy = cy0; cy <= cy1; cy++) {
+		for (int32 cx = cx0; cx <= cx1; cx++) {
+			const Common::Array<SortItem *> &cell = _cells[cy * _cellCols + cx];
+			for (uint i = 0; i < cell.size(); i++) {
+				SortItem *si2 = cell[i];
+				if (si2->_visitIndex != si->_addIndex) {
+					si2->_visitIndex = si->_addIndex;
+					_candidates.push_back(si2);
+				}
+			}
+		}
+	}
+#endif // SORTITEM_OCCLUSION_EXPERIMENTAL
+	Common::sort(_candidates.begin(), _candidates.end(), listOrderLess);
 
-	// Ok,
-	SortItem *addpoint = nullptr;
-	for (SortItem *si2 = _items; si2 != nullptr; si2 = si2->_next) {
-		// Get the insert point... which is before the first item that has higher z than us
-		if (!addpoint && si->listLessThan(*si2))
-			addpoint = si2;
+	for (uint i = 0; i < _candidates.size(); i++) {
+		SortItem *si2 = _candidates[i];
 
 		if (si2->_occluded)
 			continue;
 
+		_stats.comparisons++;
+
 #ifdef SORTITEM_OCCLUSION_EXPERIMENTAL
 		// Find adjoining rects for better occlusion
 		if (si->_occl && si2->_occl && si->_z == si2->_z) {
@@ -226,18 +288,22 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 				if (si2->_occl && si2->occludes(*si)) {
 					// No need to do any more checks, this isn't visible
 					si->_occluded = true;
+					_stats.occluded++;
 					break;
 				} else {
 					// si1 is behind si2, so add it to si2's dependency list
 					si2->_depends.insert_sorted(si);
+					_stats.edges++;
 				}
 			} else {
 				if (si->_occl && si->occludes(*si2)) {
 					// Occluded, but we can't remove it from the list
 					si2->_occluded = true;
+					_stats.occluded++;
 				} else {
 					// si2 is behind si1, so add it to si1's dependency list
 					si->_depends.insert_sorted(si2);
+					_stats.edges++;
 				}
 			}
 		}
@@ -245,27 +311,13 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 
 	// Add it to the list
 	_itemsUnused = _itemsUnused->_next;
+	_itemList.push_back(si);
+	_itemListSorted = false;
+	_stats.items++;
 
-	// have a position
-	//addpoint = 0;
-	if (addpoint) {
-		si->_next = addpoint;
-		si->_prev = addpoint->_prev;
-		addpoint->_prev = si;
-		if (si->_prev)
-			si->_prev->_next = si;
-		else
-			_items = si;
-	}
-	// Add it to the end of the list
-	else {
-		if (_itemsTail)
-			_itemsTail->_next = si;
-		if (!_items)
-			_items = si;
-		si->_next = nullptr;
-		si->_prev = _itemsTail;
-		_itemsTail = si;
+	for (int32 cy = cy0; cy <= cy1; cy++) {
+		for (int32 cx = cx0; cx <= cx1; cx++)
+			_cells[cy * _cellCols + cx].push_back(si);
 	}
 }
 
@@ -274,7 +326,39 @@ void ItemSorter::AddItem(const Item *add) {
 			add->getFlags(), add->getExtFlags(), add->getObjId());
 }
 
+void ItemSorter::GetCellRange(const SortItem *si, int32 &cx0, int32 &cy0, int32 &cx1, int32 &cy1) const {
+	// Cells outside the clip window are clamped to the edge cells, which
+	// keeps the mapping monotonic so intersecting rects still share a cell
+	cx0 = CLIP<int32>((si->_sr.left - _clipWindow.left) / kCellSize, 0, _cellCols - 1);
+	cy0 = CLIP<int32>((si->_sr.top - _clipWindow.top) / kCellSize, 0, _cellRows - 1);
+	cx1 = CLIP<int32>((si->_sr.right - 1 - _clipWindow.left) / kCellSize, 0, _cellCols - 1);
+	cy1 = CLIP<int32>((si->_sr.bottom - 1 - _clipWindow.top) / kCellSize, 0, _cellRows - 1);
+}
+
+void ItemSorter::SortDisplayList() {
+	if (_itemListSorted)
+		return;
+
+	Common::sort(_itemList.begin(), _itemList.end(), listOrderLess);
+
+	SortItem *prev = nullptr;
+	for (uint i = 0; i < _itemList.size(); i++) {
+		SortItem *si = _itemList[i];
+		si->_prev = prev;
+		si->_next = nullptr;
+		if (prev)
+			prev->_next = si;
+		prev = si;
+	}
+
+	_items = _itemList.empty() ? nullptr : _itemList.front();
+	_itemsTail = prev;
+	_itemListSorted = true;
+}
+
 void ItemSorter::PaintDisplayList(RenderSurface *surf, bool item_highlight, bool showFootpads) {
+	SortDisplayList();
+
 	if (_sortLimit) {
 		// Clear the surface when debugging the sorter
 		uint32 color = TEX32_PACK_RGB(0, 0, 0);
@@ -481,6 +565,8 @@ bool ItemSorter::PaintSortItem(RenderSurface *surf, SortItem *si, bool showFootp
 
 	// Set our painting _order based on previously painted item
 	si->_order = _painted ? _painted->_order + 1 : 0;
+	if (surf)
+		_stats.painted++;
 
 	if (_sortLimit && si->_order == _sortLimit) {
 		if (_sortLimitChanged) {
@@ -507,6 +593,8 @@ uint16 ItemSorter::Trace(int32 x, int32 y, HitFace *face, bool item_highlight) {
 	SortItem *it;
 	SortItem *selected;
 
+	SortDisplayList();
+
 	if (!_painted) { // If no painted item found, we need to sort the items
 		it = _items;
 		_painted = nullptr;
@@ -22,6 +22,7 @@
 #ifndef ULTIMA8_WORLD_ITEMSORTER_H
 #define ULTIMA8_WORLD_ITEMSORTER_H
 
+#include "common/array.h"
 #include "ultima/ultima8/misc/rect.h"
 
 namespace Ultima {
@@ -34,6 +35,20 @@ struct SortItem;
 struct Point3;
 
 class ItemSorter {
+public:
+	// Counters for the current display list, reset by BeginDisplayList
+	struct Stats {
+		uint32 items;       // Items added to the display list
+		uint32 comparisons; // Item pairs tested against each other
+		uint32 edges;       // Paint dependencies recorded
+		uint32 occluded;    // Items found to be fully occluded
+		uint32 painted;     // Items painted to the surface
+	};
+
+private:
+	// Size in pixels of the square screenspace cells used to find overlapping items
+	static const int32 kCellSize = 64;
+
 	MainShapeArchive    *_shapes;
 	Rect        _clipWindow;
 
@@ -42,6 +57,20 @@ class ItemSorter {
 	SortItem    *_itemsUnused;
 	SortItem    *_painted;
 
+	// Items in the order they were added. The linked list above is only
+	// built from this once the display list is complete.
+	Common::Array<SortItem *> _itemList;
+	bool        _itemListSorted;
+
+	// Screenspace grid of the items overlapping each cell of the clip window
+	Common::Array<Common::Array<SortItem *> > _cells;
+	int32       _cellCols, _cellRows;
+
+	// Scratch list of items that may overlap the item being added
+	Common::Array<SortItem *> _candidates;
+
+	Stats       _stats;
+
 	int32       _camSx, _camSy;
 	int32       _sortLimit;
 	bool        _sortLimitChanged;
@@ -69,8 +98,17 @@ public:
 
 	void IncSortLimit(int count);
 
+	const Stats &getStats() const {
+		return _stats;
+	}
+
 private:
 	bool PaintSortItem(RenderSurface *surf, SortItem *si, bool showFootpad);
+
+	// Sort the added items and link them into the paint list
+	void SortDisplayList();
+
+	void GetCellRange(const SortItem *si, int32 &cx0, int32 &cy0, int32 &cx1, int32 &cy1) const;
 };
 
 } // End of namespace Ultima8
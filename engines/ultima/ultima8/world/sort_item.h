@@ -41,7 +41,7 @@ class Shape;
  * Other code should have no reason to include it.
  */
 struct SortItem {
-	SortItem() : _next(nullptr), _prev(nullptr), _itemNum(0),
+	SortItem() : _next(nullptr), _prev(nullptr), _addIndex(0), _visitIndex(0), _itemNum(0),
 			_shape(nullptr), _order(-1), _depends(), _shapeNum(0),
 			_frame(0), _flags(0), _extFlags(0), _sr(),
 			_x(0), _y(0), _z(0), _xLeft(0),
@@ -55,6 +55,9 @@ struct SortItem {
 	SortItem                *_next;
 	SortItem                *_prev;
 
+	uint32                  _addIndex;   // Position in which this was added to the display list
+	uint32                  _visitIndex; // _addIndex of the last item this was collected for
+
 	uint16                  _itemNum;   // Owner item number
 
 	const Shape             *_shape;
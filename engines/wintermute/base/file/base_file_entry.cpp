@@ -34,15 +34,34 @@
 namespace Wintermute {
 
 Common::SeekableReadStream *BaseFileEntry::createReadStream() const {
+	bool compressed = (_compressedLength != 0);
+
+	if (compressed && _length <= BasePackage::kMaxCachedEntrySize) {
+		Common::SeekableReadStream *cached = _package->getCachedEntry(_offset);
+		if (cached) {
+			return cached;
+		}
+	}
+
 	Common::SeekableReadStream *file = _package->getFilePointer();
 	if (!file) {
 		return nullptr;
 	}
 
-	bool compressed = (_compressedLength != 0);
-
 	if (compressed) {
 		file = Common::wrapCompressedReadStream(new Common::SeekableSubReadStream(file, _offset, _offset + _compressedLength, DisposeAfterUse::YES), DisposeAfterUse::YES, _length); //
+
+		// Small entries are inflated once and then served from memory
+		if (file && _length <= BasePackage::kMaxCachedEntrySize) {
+			byte *data = new byte[_length];
+			uint32 bytesRead = file->read(data, _length);
+			if (bytesRead == _length && !file->err()) {
+				delete file;
+				return _package->addCachedEntry(_offset, data, _length);
+			}
+			delete[] data;
+			file->seek(0);
+		}
 	} else {
 		file = new Common::SeekableSubReadStream(file, _offset, _offset + _length, DisposeAfterUse::YES);
 	}
@@ -30,17 +30,30 @@
 #include "engines/wintermute/base/file/base_file_entry.h"
 #include "engines/wintermute/base/file/dcpackage.h"
 #include "engines/wintermute/wintermute.h"
+#include "common/bufferedstream.h"
 #include "common/file.h"
+#include "common/memstream.h"
 #include "common/stream.h"
 #include "common/debug.h"
 
 namespace Wintermute {
 
+// Keeps the shared buffer alive even if the entry is evicted from the cache
+class CachedEntryStream : public Common::MemoryReadStream {
+public:
+	CachedEntryStream(const Common::SharedPtr<byte> &data, uint32 size) :
+		Common::MemoryReadStream(data.get(), size, DisposeAfterUse::NO), _data(data) {}
+
+private:
+	Common::SharedPtr<byte> _data;
+};
+
 BasePackage::BasePackage() {
 	_name = "";
 	_cd = 0;
 	_priority = 0;
 	_boundToExe = false;
+	_cacheSize = 0;
 }
 
 Common::SeekableReadStream *BasePackage::getFilePointer() {
@@ -49,6 +62,38 @@ Common::SeekableReadStream *BasePackage::getFilePointer() {
 	return stream;
 }
 
+Common::SeekableReadStream *BasePackage::getCachedEntry(uint32 offset) {
+	for (Common::List<CachedEntry>::iterator it = _cache.begin(); it != _cache.end(); ++it) {
+		if (it->_offset == offset) {
+			CachedEntry entry = *it;
+			if (it != _cache.begin()) {
+				_cache.erase(it);
+				_cache.push_front(entry);
+			}
+			return new CachedEntryStream(entry._data, entry._size);
+		}
+	}
+	return nullptr;
+}
+
+Common::SeekableReadStream *BasePackage::addCachedEntry(uint32 offset, byte *data, uint32 size) {
+	CachedEntry entry;
+	entry._offset = offset;
+	entry._size = size;
+	entry._data = Common::SharedPtr<byte>(data, Common::ArrayDeleter<byte>());
+
+	if (size <= kMaxCachedEntrySize) {
+		while (!_cache.empty() && _cacheSize + size > kMaxCacheSize) {
+			_cacheSize -= _cache.back()._size;
+			_cache.pop_back();
+		}
+		_cache.push_front(entry);
+		_cacheSize += size;
+	}
+
+	return new CachedEntryStream(entry._data, entry._size);
+}
+
 static bool findPackageSignature(Common::SeekableReadStream *f, uint32 *offset) {
 	byte buf[32768];
 
@@ -117,6 +162,8 @@ PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool
 	if (!stream) {
 		return;
 	}
+	// The directory consists of many tiny fields, read it through a buffer
+	stream = Common::wrapBufferedSeekableReadStream(stream, 65536, DisposeAfterUse::YES);
 	if (searchSignature) {
 		uint32 offset;
 		if (!findPackageSignature(stream, &offset)) {
@@ -161,14 +208,13 @@ PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool
 		pkg->_boundToExe = boundToExe;
 
 		// read package info
+		char name[256];
 		byte nameLength = stream->readByte();
-		char *pkgName = new char[nameLength];
-		stream->read(pkgName, nameLength);
-		pkg->_name = pkgName;
+		stream->read(name, nameLength);
+		name[nameLength] = '\0';
+		pkg->_name = name;
 		pkg->_cd = stream->readByte();
 		pkg->_priority = hdr._priority;
-		delete[] pkgName;
-		pkgName = nullptr;
 
 		if (!hdr._masterIndex) {
 			pkg->_cd = 0;    // override CD to fixed disk
@@ -179,12 +225,11 @@ PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool
 		uint32 numFiles = stream->readUint32LE();
 
 		for (uint32 j = 0; j < numFiles; j++) {
-			char *name;
 			uint32 offset, length, compLength, flags;/*, timeDate1, timeDate2;*/
 
 			nameLength = stream->readByte();
-			name = new char[nameLength];
 			stream->read(name, nameLength);
+			name[nameLength] = '\0';
 
 			// v2 - xor name
 			if (hdr._packageVersion == PACKAGE_VERSION) {
@@ -195,8 +240,6 @@ PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool
 			debugC(kWintermuteDebugFileAccess, "Package contains %s", name);
 
 			Common::Path path(name, '\\');
-			delete[] name;
-			name = nullptr;
 
 			offset = stream->readUint32LE();
 			offset += absoluteOffset;
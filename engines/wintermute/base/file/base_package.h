@@ -31,17 +31,38 @@
 #include "common/archive.h"
 #include "common/stream.h"
 #include "common/fs.h"
+#include "common/list.h"
+#include "common/ptr.h"
 
 namespace Wintermute {
 class BasePackage {
 public:
+	/**
+	 * Decompressed entries up to this size are kept in memory, so that
+	 * reopening them does not inflate the data again.
+	 */
+	static const uint32 kMaxCachedEntrySize = 256 * 1024;
+	static const uint32 kMaxCacheSize = 2 * 1024 * 1024;
+
 	Common::SeekableReadStream *getFilePointer();
+	Common::SeekableReadStream *getCachedEntry(uint32 offset);
+	Common::SeekableReadStream *addCachedEntry(uint32 offset, byte *data, uint32 size);
 	Common::FSNode _fsnode;
 	bool _boundToExe;
 	byte _priority;
 	Common::String _name;
 	int32 _cd;
 	BasePackage();
+
+private:
+	struct CachedEntry {
+		uint32 _offset;
+		uint32 _size;
+		Common::SharedPtr<byte> _data;
+	};
+	// Most recently used entries first
+	Common::List<CachedEntry> _cache;
+	uint32 _cacheSize;
 };
 
 class PackageSet : public Common::Archive {
@@ -288,6 +288,24 @@ Graphics::PixelFormat BaseRenderOSystem::getPixelFormat() const {
 void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf,
                                     Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform) {
 	if (_disableDirtyRects) {
+		// The tickets of the previous frame are kept at the front of the
+		// queue until flip(). An identical draw can reuse the clipped and
+		// possibly scaled or rotated copy of the surface made for it.
+		if (owner) {
+			RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
+			RenderQueueIterator endIterator = _renderQueue.end();
+			for (RenderQueueIterator it = _renderQueue.begin(); it != endIterator && !(*it)->_wantsDraw; ++it) {
+				RenderTicket *oldTicket = *it;
+				if (oldTicket->_isValid && *oldTicket == compare) {
+					_renderQueue.erase(it);
+					oldTicket->_wantsDraw = true;
+					_renderQueue.push_back(oldTicket);
+					drawFromSurface(oldTicket);
+					return;
+				}
+			}
+		}
+
 		RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
 		ticket->_wantsDraw = true;
 		_renderQueue.push_back(ticket);
@@ -30,8 +30,6 @@
 #include "engines/wintermute/base/gfx/osystem/render_ticket.h"
 #include "engines/wintermute/base/gfx/osystem/base_surface_osystem.h"
 
-#include "graphics/managed_surface.h"
-
 #include "common/textconsole.h"
 
 namespace Wintermute {
@@ -45,7 +43,7 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 	        _wantsDraw(true),
 	        _transform(transform) {
 	if (surf) {
-		_surface = new Graphics::Surface();
+		_surface = new Graphics::ManagedSurface();
 		_surface->create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
 		assert(_surface->format.bytesPerPixel == 4);
 		// Get a clipped copy of the surface
@@ -61,15 +59,13 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 		// (Mirroring should most likely be done before rotation. See also
 		// TransformTools.)
 		if (_transform._angle != Graphics::kDefaultAngle) {
-			Graphics::Surface *temp = _surface->rotoscale(transform, owner->_gameRef->getBilinearFiltering());
-			_surface->free();
+			Graphics::ManagedSurface *temp = _surface->rotoscale(transform, owner->_gameRef->getBilinearFiltering());
 			delete _surface;
 			_surface = temp;
 		} else if ((dstRect->width() != srcRect->width() ||
 					dstRect->height() != srcRect->height()) &&
 					_transform._numTimesX * _transform._numTimesY == 1) {
-			Graphics::Surface *temp = _surface->scale(dstRect->width(), dstRect->height(), owner->_gameRef->getBilinearFiltering());
-			_surface->free();
+			Graphics::ManagedSurface *temp = _surface->scale(dstRect->width(), dstRect->height(), owner->_gameRef->getBilinearFiltering());
 			delete _surface;
 			_surface = temp;
 		}
@@ -79,10 +75,7 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 }
 
 RenderTicket::~RenderTicket() {
-	if (_surface) {
-		_surface->free();
-		delete _surface;
-	}
+	delete _surface;
 }
 
 bool RenderTicket::operator==(const RenderTicket &t) const {
@@ -98,8 +91,7 @@ bool RenderTicket::operator==(const RenderTicket &t) const {
 
 // Replacement for SDL2's SDL_RenderCopy
 void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface) const {
-	Graphics::ManagedSurface src;
-	src.copyFrom(*getSurface());
+	Graphics::ManagedSurface &src = *_surface;
 
 	Common::Rect clipRect;
 	clipRect.setWidth(getSurface()->w);
@@ -133,8 +125,7 @@ void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface) const {
 }
 
 void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface, Common::Rect *dstRect, Common::Rect *clipRect) const {
-	Graphics::ManagedSurface src;
-	src.copyFrom(*getSurface());
+	Graphics::ManagedSurface &src = *_surface;
 
 	bool doDelete = false;
 	if (!clipRect) {
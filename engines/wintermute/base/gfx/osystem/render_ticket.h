@@ -28,6 +28,7 @@
 #ifndef WINTERMUTE_RENDER_TICKET_H
 #define WINTERMUTE_RENDER_TICKET_H
 
+#include "graphics/managed_surface.h"
 #include "graphics/surface.h"
 
 #include "common/rect.h"
@@ -53,7 +54,7 @@ public:
 	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform);
 	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()) {}
 	~RenderTicket();
-	const Graphics::Surface *getSurface() const { return _surface; }
+	const Graphics::Surface *getSurface() const { return _surface ? &_surface->rawSurface() : nullptr; }
 	// Non-dirty-rects:
 	void drawToSurface(Graphics::Surface *_targetSurface) const;
 	// Dirty-rects:
@@ -70,7 +71,8 @@ public:
 	bool operator==(const RenderTicket &a) const;
 	const Common::Rect *getSrcRect() const { return &_srcRect; }
 private:
-	Graphics::Surface *_surface;
+	// Kept as a ManagedSurface so that drawing can blit from it directly
+	Graphics::ManagedSurface *_surface;
 	Common::Rect _srcRect;
 };
 
@@ -57,6 +57,7 @@ ScScript::ScScript(BaseGame *inGame, ScEngine *engine) : BaseClass(inGame) {
 
 	_symbols = nullptr;
 	_numSymbols = 0;
+	_varCache = nullptr;
 
 	_engine = engine;
 
@@ -188,6 +189,14 @@ bool ScScript::initTables() {
 		_symbols[index] = getString();
 	}
 
+	delete[] _varCache;
+	_varCache = new TVarCacheEntry[_numSymbols];
+	for (uint32 i = 0; i < _numSymbols; i++) {
+		_varCache[i].generation = 0;
+		_varCache[i].scope = nullptr;
+		_varCache[i].value = nullptr;
+	}
+
 	// load functions table
 	_iP = _header.funcTable;
 
@@ -397,6 +406,9 @@ void ScScript::cleanup() {
 	_symbols = nullptr;
 	_numSymbols = 0;
 
+	delete[] _varCache;
+	_varCache = nullptr;
+
 	if (_globals && !_thread) {
 		delete _globals;
 	}
@@ -742,7 +754,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_VAR: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getVar(getDWORD());
 		// Disabled in original code
 		/*if (false && var->_type==VAL_OBJECT || var->_type == VAL_NATIVE) {
 			_operand->setReference(var);
@@ -754,15 +766,14 @@ bool ScScript::executeInstruction() {
 	}
 
 	case II_PUSH_VAR_REF: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getVar(getDWORD());
 		_operand->setReference(var);
 		_stack->push(_operand);
 		break;
 	}
 
 	case II_POP_VAR: {
-		char *varName = _symbols[getDWORD()];
-		ScValue *var = getVar(varName);
+		ScValue *var = getVar(getDWORD());
 		if (var) {
 			ScValue *val = _stack->pop();
 			if (!val) {
@@ -813,7 +824,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_THIS:
-		_operand->setReference(getVar(_symbols[getDWORD()]));
+		_operand->setReference(getVar(getDWORD()));
 		_thisStack->push(_operand);
 		break;
 
@@ -1171,6 +1182,24 @@ uint32 ScScript::getMethodPos(const Common::String &name) const {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScScript::getVar(uint32 symbol) {
+	// Variables are looked up in the local scope, the script globals and
+	// the engine globals, hashing the name every time. As long as no
+	// property has been added or removed anywhere and the scope is the
+	// same, the previous result for the symbol is still valid.
+	ScValue *scope = _scopeStack->getTop();
+	TVarCacheEntry &entry = _varCache[symbol];
+
+	if (entry.generation != ScValue::_propGeneration || entry.scope != scope) {
+		entry.value = getVar(_symbols[symbol]);
+		entry.generation = ScValue::_propGeneration;
+		entry.scope = scope;
+	}
+
+	return entry.value;
+}
+
 //////////////////////////////////////////////////////////////////////////
 ScValue *ScScript::getVar(char *name) {
 	ScValue *ret = nullptr;
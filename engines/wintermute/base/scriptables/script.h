@@ -79,6 +79,7 @@ public:
 	TScriptState _state;
 	TScriptState _origState;
 	ScValue *getVar(char *name);
+	ScValue *getVar(uint32 symbol);
 	uint32 getFuncPos(const Common::String &name);
 	uint32 getEventPos(const Common::String &name) const;
 	uint32 getMethodPos(const Common::String &name) const;
@@ -152,6 +153,15 @@ public:
 private:
 	char **_symbols;
 	uint32 _numSymbols;
+
+	// Result of the last getVar() for each symbol, valid while the scope
+	// and ScValue::_propGeneration are unchanged.
+	struct TVarCacheEntry {
+		uint32 generation;
+		ScValue *scope;
+		ScValue *value;
+	};
+	TVarCacheEntry *_varCache;
 	TFunctionPos *_functions;
 	TMethodPos *_methods;
 	TEventPos *_events;
@@ -41,6 +41,8 @@ namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(ScValue, false)
 
+uint32 ScValue::_propGeneration = 1;
+
 //////////////////////////////////////////////////////////////////////////
 ScValue::ScValue(BaseGame *inGame) : BaseClass(inGame) {
 	_type = VAL_NULL;
@@ -200,6 +202,7 @@ bool ScValue::deleteProp(const char *name) {
 	if (_valIter != _valObject.end()) {
 		delete _valIter->_value;
 		_valIter->_value = nullptr;
+		_propGeneration++;
 	}
 
 	return STATUS_OK;
@@ -227,6 +230,7 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 		}
 		if (!newVal) {
 			newVal = new ScValue(_gameRef);
+			_propGeneration++;
 		} else {
 			newVal->cleanup();
 		}
@@ -271,6 +275,10 @@ bool ScValue::propExists(const char *name) {
 
 //////////////////////////////////////////////////////////////////////////
 void ScValue::deleteProps() {
+	if (!_valObject.empty()) {
+		_propGeneration++;
+	}
+
 	_valIter = _valObject.begin();
 	while (_valIter != _valObject.end()) {
 		delete(ScValue *)_valIter->_value;
@@ -735,6 +743,10 @@ void ScValue::copy(ScValue *orig, bool copyWhole) {
 //!!!! ref->native++
 
 	// copy properties
+	if (!_valObject.empty() || !orig->_valObject.empty()) {
+		_propGeneration++;
+	}
+
 	if (orig->_type == VAL_OBJECT && orig->_valObject.size() > 0) {
 		orig->_valIter = orig->_valObject.begin();
 		while (orig->_valIter != orig->_valObject.end()) {
@@ -810,6 +822,7 @@ bool ScValue::persist(BasePersistenceManager *persistMgr) {
 	} else {
 		ScValue *val = nullptr;
 		persistMgr->transferSint32("", &size);
+		_propGeneration++;
 		for (int i = 0; i < size; i++) {
 			persistMgr->transferConstChar("", &str);
 			persistMgr->transferPtr("", &val);
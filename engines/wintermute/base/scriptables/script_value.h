@@ -100,6 +100,10 @@ public:
 	Common::HashMap<Common::String, ScValue *> _valObject;
 	Common::HashMap<Common::String, ScValue *>::iterator _valIter;
 
+	// Bumped whenever a property is added to or removed from any value.
+	// Scripts use it to tell whether their cached variable lookups are stale.
+	static uint32 _propGeneration;
+
 	bool setProperty(const char *propName, int32 value);
 	bool setProperty(const char *propName, const char *value);
 	bool setProperty(const char *propName, double value);
@@ -0,0 +1,116 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Vectorized version of the split-radix pass in math/fft.cpp
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "math/fft.h"
+#include "math/utils.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__)
+
+namespace Math {
+
+// Same operations as TRANSFORM() in math/fft.cpp, on four sets of inputs
+static FORCEINLINE void transform4(Complex *a0, Complex *a1, Complex *a2, Complex *a3, float32x4_t wre, float32x4_t wim) {
+	// vld2q_f32 splits the interleaved complex values into { re, im }
+	float32x4x2_t z0 = vld2q_f32(&a0->re);
+	float32x4x2_t z1 = vld2q_f32(&a1->re);
+	float32x4x2_t z2 = vld2q_f32(&a2->re);
+	float32x4x2_t z3 = vld2q_f32(&a3->re);
+
+	const float32x4_t t1 = vaddq_f32(vmulq_f32(z2.val[0], wre), vmulq_f32(z2.val[1], wim));
+	const float32x4_t t2 = vsubq_f32(vmulq_f32(z2.val[1], wre), vmulq_f32(z2.val[0], wim));
+	float32x4_t t5 = vsubq_f32(vmulq_f32(z3.val[0], wre), vmulq_f32(z3.val[1], wim));
+	float32x4_t t6 = vaddq_f32(vmulq_f32(z3.val[1], wre), vmulq_f32(z3.val[0], wim));
+
+	const float32x4_t t3 = vsubq_f32(t5, t1);
+	t5 = vaddq_f32(t5, t1);
+	const float32x4_t t4 = vsubq_f32(t2, t6);
+	t6 = vaddq_f32(t2, t6);
+
+	z2.val[0] = vsubq_f32(z0.val[0], t5);
+	z2.val[1] = vsubq_f32(z0.val[1], t6);
+	z0.val[0] = vaddq_f32(z0.val[0], t5);
+	z0.val[1] = vaddq_f32(z0.val[1], t6);
+	z3.val[0] = vsubq_f32(z1.val[0], t4);
+	z3.val[1] = vsubq_f32(z1.val[1], t3);
+	z1.val[0] = vaddq_f32(z1.val[0], t4);
+	z1.val[1] = vaddq_f32(z1.val[1], t3);
+
+	vst2q_f32(&a0->re, z0);
+	vst2q_f32(&a1->re, z1);
+	vst2q_f32(&a2->re, z2);
+	vst2q_f32(&a3->re, z3);
+}
+
+static FORCEINLINE float32x4_t reverse4(float32x4_t v) {
+	v = vrev64q_f32(v);
+	return vcombine_f32(vget_high_f32(v), vget_low_f32(v));
+}
+
+void FFT::passNEON(Complex *z, const float *wre, unsigned int n) {
+	assert(n >= 2 && !(n & 1));
+
+	const int o1 = 2 * n;
+	const int o2 = 4 * n;
+	const int o3 = 6 * n;
+	const float *wim = wre + o1;
+
+	// The twiddle factors for z[k] are wre[k] and wim[-k]. The first set
+	// uses exactly 1 and 0 like TRANSFORM_ZERO, so that the results match
+	// the scalar pass.
+	const float firstRe[4] = { 1.0f, wre[1], wre[2], wre[3] };
+	const float firstIm[4] = { 0.0f, wim[-1], wim[-2], wim[-3] };
+	transform4(z, z + o1, z + o2, z + o3, vld1q_f32(firstRe), vld1q_f32(firstIm));
+
+	for (int k = 4; k < o1; k += 4)
+		transform4(z + k, z + o1 + k, z + o2 + k, z + o3 + k,
+		           vld1q_f32(wre + k), reverse4(vld1q_f32(wim - k - 3)));
+}
+
+} // End of namespace Math
+
+#if !defined(__aarch64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__)
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,120 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Vectorized version of the split-radix pass in math/fft.cpp
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_SSE2
+
+#include "math/fft.h"
+#include "math/utils.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Math {
+
+static FORCEINLINE void loadComplex4(const Complex *z, __m128 &re, __m128 &im) {
+	const __m128 lo = _mm_loadu_ps(&z[0].re);
+	const __m128 hi = _mm_loadu_ps(&z[2].re);
+
+	re = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+	im = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+static FORCEINLINE void storeComplex4(Complex *z, __m128 re, __m128 im) {
+	_mm_storeu_ps(&z[0].re, _mm_unpacklo_ps(re, im));
+	_mm_storeu_ps(&z[2].re, _mm_unpackhi_ps(re, im));
+}
+
+// Same operations as TRANSFORM() in math/fft.cpp, on four sets of inputs
+static FORCEINLINE void transform4(Complex *a0, Complex *a1, Complex *a2, Complex *a3, __m128 wre, __m128 wim) {
+	__m128 r0, i0, r1, i1, r2, i2, r3, i3;
+
+	loadComplex4(a0, r0, i0);
+	loadComplex4(a1, r1, i1);
+	loadComplex4(a2, r2, i2);
+	loadComplex4(a3, r3, i3);
+
+	const __m128 t1 = _mm_add_ps(_mm_mul_ps(r2, wre), _mm_mul_ps(i2, wim));
+	const __m128 t2 = _mm_sub_ps(_mm_mul_ps(i2, wre), _mm_mul_ps(r2, wim));
+	__m128 t5 = _mm_sub_ps(_mm_mul_ps(r3, wre), _mm_mul_ps(i3, wim));
+	__m128 t6 = _mm_add_ps(_mm_mul_ps(i3, wre), _mm_mul_ps(r3, wim));
+
+	const __m128 t3 = _mm_sub_ps(t5, t1);
+	t5 = _mm_add_ps(t5, t1);
+	const __m128 t4 = _mm_sub_ps(t2, t6);
+	t6 = _mm_add_ps(t2, t6);
+
+	storeComplex4(a2, _mm_sub_ps(r0, t5), _mm_sub_ps(i0, t6));
+	storeComplex4(a0, _mm_add_ps(r0, t5), _mm_add_ps(i0, t6));
+	storeComplex4(a3, _mm_sub_ps(r1, t4), _mm_sub_ps(i1, t3));
+	storeComplex4(a1, _mm_add_ps(r1, t4), _mm_add_ps(i1, t3));
+}
+
+void FFT::passSSE2(Complex *z, const float *wre, unsigned int n) {
+	assert(n >= 2 && !(n & 1));
+
+	const int o1 = 2 * n;
+	const int o2 = 4 * n;
+	const int o3 = 6 * n;
+	const float *wim = wre + o1;
+
+	// The twiddle factors for z[k] are wre[k] and wim[-k]. The first set
+	// uses exactly 1 and 0 like TRANSFORM_ZERO, so that the results match
+	// the scalar pass.
+	transform4(z, z + o1, z + o2, z + o3,
+	           _mm_setr_ps(1.0f, wre[1], wre[2], wre[3]),
+	           _mm_setr_ps(0.0f, wim[-1], wim[-2], wim[-3]));
+
+	for (int k = 4; k < o1; k += 4) {
+		const __m128 vre = _mm_loadu_ps(wre + k);
+		const __m128 vim = _mm_loadu_ps(wim - k - 3);
+
+		transform4(z + k, z + o1 + k, z + o2 + k, z + o3 + k,
+		           vre, _mm_shuffle_ps(vim, vim, _MM_SHUFFLE(0, 1, 2, 3)));
+	}
+}
+
+} // End of namespace Math
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
+
+#endif // SCUMMVM_SSE2
@@ -28,13 +28,22 @@
 #include "math/fft.h"
 #include "math/cosinetables.h"
 #include "math/utils.h"
+#include "common/system.h"
 #include "common/util.h"
 
 namespace Math {
 
+// Initialize these to nullptr at the start
+FFT::PassFunc FFT::_passFunc = nullptr;
+FFT::PassFunc FFT::_passBigFunc = nullptr;
+
 FFT::FFT(int bits, int inverse) : _bits(bits), _inverse(inverse) {
 	assert((_bits >= 2) && (_bits <= 16));
 
+	// If no pass function has been selected yet, detect and select
+	if (!_passFunc)
+		initPassFuncs();
+
 	int n = 1 << bits;
 	int nPoints;
 
@@ -180,6 +189,34 @@ PASS(pass)
 #define BUTTERFLIES BUTTERFLIES_BIG
 PASS(pass_big)
 
+void FFT::initPassFuncs() {
+	_passFunc = pass;
+	_passBigFunc = pass_big;
+
+	// The vector passes load all of their inputs before storing anything,
+	// so they also take care of the sizes handled by pass_big.
+	// SSE2 and NEON are part of the baseline of x86-64 and AArch64, so
+	// there is no need to ask the backend about them there.
+#ifdef SCUMMVM_NEON
+#if defined(__aarch64__)
+	const bool hasNEON = true;
+#else
+	const bool hasNEON = g_system && g_system->hasFeature(OSystem::kFeatureCpuNEON);
+#endif
+	if (hasNEON)
+		_passFunc = _passBigFunc = passNEON;
+#endif
+#ifdef SCUMMVM_SSE2
+#if defined(__x86_64__) || defined(_M_X64)
+	const bool hasSSE2 = true;
+#else
+	const bool hasSSE2 = g_system && g_system->hasFeature(OSystem::kFeatureCpuSSE2);
+#endif
+	if (hasSSE2)
+		_passFunc = _passBigFunc = passSSE2;
+#endif
+}
+
 void FFT::fft4(Complex *z) {
 	float t1, t2, t3, t4, t5, t6, t7, t8;
 
@@ -245,9 +282,9 @@ void FFT::fft(int n, int logn, Complex *z) {
 		fft((n / 4), logn - 2, z + (n / 4) * 3);
 		assert(_cosTables[logn - 4]);
 		if (n > 1024)
-			pass_big(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
+			_passBigFunc(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
 		else
-			pass(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
+			_passFunc(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
 	}
 }
 
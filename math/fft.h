@@ -86,6 +86,25 @@ private:
 	void fft8(Complex *z);
 	void fft16(Complex *z);
 	void fft(int n, int logn, Complex *z);
+
+	/**
+	 * Split-radix combining pass over z[0...8n-1], using the
+	 * twiddle factors in w[0...2n].
+	 */
+	typedef void (*PassFunc)(Complex *z, const float *w, unsigned int n);
+
+	/** Detect and select the pass implementations for the running CPU. */
+	static void initPassFuncs();
+
+	static PassFunc _passFunc;
+	static PassFunc _passBigFunc;
+
+#ifdef SCUMMVM_NEON
+	static void passNEON(Complex *z, const float *w, unsigned int n);
+#endif
+#ifdef SCUMMVM_SSE2
+	static void passSSE2(Complex *z, const float *w, unsigned int n);
+#endif
 };
 
 /** @} */
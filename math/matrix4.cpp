@@ -34,15 +34,24 @@ Matrix<4, 4>::Matrix(const MatrixBase<4, 4> &m) :
 }
 
 void Matrix<4, 4>::transform(Vector3d *v, bool trans) const {
-	Vector4d m;
-	m(0, 0) = v->x();
-	m(1, 0) = v->y();
-	m(2, 0) = v->z();
-	m(3, 0) = (trans ? 1.f : 0.f);
-
-	m = *this * m;
+	transform(v, v, 1, trans);
+}
 
-	v->set(m(0, 0), m(1, 0), m(2, 0));
+void Matrix<4, 4>::transform(Vector3d *dst, const Vector3d *src, uint count, bool trans) const {
+	// Keep the rows of the matrix in locals, the compiler cannot know that
+	// the stores to dst do not alias them.
+	const float *d = getData();
+	const float m00 = d[0], m01 = d[1], m02 = d[2],  m03 = trans ? d[3]  : 0.f;
+	const float m10 = d[4], m11 = d[5], m12 = d[6],  m13 = trans ? d[7]  : 0.f;
+	const float m20 = d[8], m21 = d[9], m22 = d[10], m23 = trans ? d[11] : 0.f;
+
+	for (uint i = 0; i < count; i++) {
+		const float x = src[i].x(), y = src[i].y(), z = src[i].z();
+
+		dst[i].set(m00 * x + m01 * y + m02 * z + m03,
+		           m10 * x + m11 * y + m12 * z + m13,
+		           m20 * x + m21 * y + m22 * z + m23);
+	}
 }
 
 Vector3d Matrix<4, 4>::getPosition() const {
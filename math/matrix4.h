@@ -40,6 +40,27 @@ public:
 
 	void transform(Vector3d *v, bool translate) const;
 
+	/**
+	 * Transforms count vectors from src and stores the results in dst.
+	 * src and dst may point to the same array.
+	 */
+	void transform(Vector3d *dst, const Vector3d *src, uint count, bool translate) const;
+
+	/**
+	 * Transforms v and adds the result, scaled by weight, to dst.
+	 * This is the building block of blending several bone influences
+	 * together when skinning vertices.
+	 */
+	inline void transformWeighted(Vector3d *dst, const Vector3d &v, float weight, bool translate) const {
+		const float *d = getData();
+		const float w = translate ? 1.f : 0.f;
+		const float x = v.x(), y = v.y(), z = v.z();
+
+		dst->x() += weight * (d[0] * x + d[1] * y + d[2]  * z + d[3]  * w);
+		dst->y() += weight * (d[4] * x + d[5] * y + d[6]  * z + d[7]  * w);
+		dst->z() += weight * (d[8] * x + d[9] * y + d[10] * z + d[11] * w);
+	}
+
 	Vector3d getPosition() const;
 	void setPosition(const Vector3d &v);
 
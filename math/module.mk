@@ -24,5 +24,14 @@ MODULE_OBJS := \
 	vector3d.o \
 	vector4d.o
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	fft-neon.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	fft-sse2.o
+endif
+
 # Include common rules
 include $(srcdir)/rules.mk
@@ -0,0 +1,100 @@
+#include <cxxtest/TestSuite.h>
+
+#include "math/fft.h"
+#include "math/rdft.h"
+#include "math/utils.h"
+
+class FFTTestSuite : public CxxTest::TestSuite {
+	static void fill(float *data, int count) {
+		// Deterministic pseudo random values in [-1, 1]
+		uint32 seed = 0x12345678;
+		for (int i = 0; i < count; i++) {
+			seed = seed * 1103515245 + 12345;
+			data[i] = ((seed >> 16) & 0x7FFF) / 16383.5f - 1.0f;
+		}
+	}
+
+public:
+	// Compare against a plain DFT, for every size that uses the split-radix passes
+	void test_fft_dft() {
+		for (int bits = 2; bits <= 10; bits++) {
+			const int n = 1 << bits;
+
+			for (int inverse = 0; inverse <= 1; inverse++) {
+				Math::Complex *z = new Math::Complex[n];
+				Math::Complex *in = new Math::Complex[n];
+				fill(&in[0].re, 2 * n);
+				memcpy(z, in, n * sizeof(Math::Complex));
+
+				Math::FFT fft(bits, inverse);
+				fft.permute(z);
+				fft.calc(z);
+
+				const double sign = inverse ? 1.0 : -1.0;
+				for (int k = 0; k < n; k++) {
+					double re = 0.0, im = 0.0;
+					for (int j = 0; j < n; j++) {
+						const double a = sign * 2.0 * M_PI * ((j * k) % n) / n;
+						re += in[j].re * cos(a) - in[j].im * sin(a);
+						im += in[j].re * sin(a) + in[j].im * cos(a);
+					}
+
+					TS_ASSERT_DELTA(z[k].re, re, 0.001 * bits);
+					TS_ASSERT_DELTA(z[k].im, im, 0.001 * bits);
+				}
+
+				delete[] in;
+				delete[] z;
+			}
+		}
+	}
+
+	// Transform forward and back again for all supported sizes
+	void test_fft_roundtrip() {
+		for (int bits = 2; bits <= 16; bits++) {
+			const int n = 1 << bits;
+
+			Math::Complex *z = new Math::Complex[n];
+			Math::Complex *in = new Math::Complex[n];
+			fill(&in[0].re, 2 * n);
+			memcpy(z, in, n * sizeof(Math::Complex));
+
+			Math::FFT fft(bits, 0);
+			Math::FFT ifft(bits, 1);
+			fft.permute(z);
+			fft.calc(z);
+			ifft.permute(z);
+			ifft.calc(z);
+
+			for (int i = 0; i < n; i++) {
+				TS_ASSERT_DELTA(z[i].re / n, in[i].re, 0.0001);
+				TS_ASSERT_DELTA(z[i].im / n, in[i].im, 0.0001);
+			}
+
+			delete[] in;
+			delete[] z;
+		}
+	}
+
+	void test_rdft_roundtrip() {
+		for (int bits = 4; bits <= 16; bits++) {
+			const int n = 1 << bits;
+
+			float *data = new float[n];
+			float *in = new float[n];
+			fill(in, n);
+			memcpy(data, in, n * sizeof(float));
+
+			Math::RDFT rdft(bits, Math::RDFT::DFT_R2C);
+			Math::RDFT irdft(bits, Math::RDFT::IDFT_C2R);
+			rdft.calc(data);
+			irdft.calc(data);
+
+			for (int i = 0; i < n; i++)
+				TS_ASSERT_DELTA(data[i] * 2 / n, in[i], 0.0001);
+
+			delete[] in;
+			delete[] data;
+		}
+	}
+};
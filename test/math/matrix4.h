@@ -0,0 +1,82 @@
+#include <cxxtest/TestSuite.h>
+
+#include "math/matrix4.h"
+
+class Matrix4TestSuite : public CxxTest::TestSuite {
+	static Math::Matrix4 makeMatrix() {
+		Math::Matrix4 m(Math::Angle(30), Math::Angle(-45), Math::Angle(10), Math::EO_ZXY);
+		m.setPosition(Math::Vector3d(1, -2, 3));
+		return m;
+	}
+
+public:
+	void test_transform() {
+		Math::Matrix4 m;
+		m.setPosition(Math::Vector3d(1, 2, 3));
+
+		Math::Vector3d v(4, 5, 6);
+		m.transform(&v, true);
+		TS_ASSERT(v == Math::Vector3d(5, 7, 9));
+
+		v.set(4, 5, 6);
+		m.transform(&v, false);
+		TS_ASSERT(v == Math::Vector3d(4, 5, 6));
+
+		// Rotation of 90 degrees around the z axis
+		Math::Matrix4 r(Math::Angle(90), Math::Angle(0), Math::Angle(0), Math::EO_ZXY);
+		v.set(1, 0, 0);
+		r.transform(&v, false);
+		TS_ASSERT_DELTA(v.x(), 0.0f, 0.0001);
+		TS_ASSERT_DELTA(v.y(), 1.0f, 0.0001);
+		TS_ASSERT_DELTA(v.z(), 0.0f, 0.0001);
+	}
+
+	void test_transformArray() {
+		const Math::Matrix4 m = makeMatrix();
+		Math::Vector3d src[4] = {
+			Math::Vector3d(1, 0, 0), Math::Vector3d(0, 1, 0),
+			Math::Vector3d(0, 0, 1), Math::Vector3d(-2.5, 4, 0.5)
+		};
+
+		for (int translate = 0; translate <= 1; translate++) {
+			Math::Vector3d dst[4];
+			m.transform(dst, src, 4, translate);
+
+			for (int i = 0; i < 4; i++) {
+				Math::Vector4d v(src[i].x(), src[i].y(), src[i].z(), translate ? 1.f : 0.f);
+				v = m * v;
+				TS_ASSERT_DELTA(dst[i].x(), v.x(), 0.0001);
+				TS_ASSERT_DELTA(dst[i].y(), v.y(), 0.0001);
+				TS_ASSERT_DELTA(dst[i].z(), v.z(), 0.0001);
+			}
+
+			// In place
+			Math::Vector3d inPlace[4];
+			for (int i = 0; i < 4; i++)
+				inPlace[i] = src[i];
+			m.transform(inPlace, inPlace, 4, translate);
+			for (int i = 0; i < 4; i++)
+				TS_ASSERT(inPlace[i] == dst[i]);
+		}
+	}
+
+	void test_transformWeighted() {
+		const Math::Matrix4 m1 = makeMatrix();
+		Math::Matrix4 m2;
+		m2.setPosition(Math::Vector3d(0, 10, 0));
+
+		const Math::Vector3d v(1, 2, 3);
+		Math::Vector3d a(v), b(v);
+		m1.transform(&a, true);
+		m2.transform(&b, true);
+
+		Math::Vector3d blended;
+		m1.transformWeighted(&blended, v, 0.25f, true);
+		m2.transformWeighted(&blended, v, 0.75f, true);
+
+		const Math::Vector3d expected = a * 0.25f + b * 0.75f;
+		TS_ASSERT_DELTA(blended.x(), expected.x(), 0.0001);
+		TS_ASSERT_DELTA(blended.y(), expected.y(), 0.0001);
+		TS_ASSERT_DELTA(blended.z(), expected.z(), 0.0001);
+	}
+};